@@ -28,6 +28,18 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#include <immintrin.h>
+#define HAVE_SCREEN_SIMD 1
+#define SCREEN_SIMD_TARGET(ISA) __attribute__((target(ISA)))
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#include <immintrin.h>
+#define HAVE_SCREEN_SIMD 1
+#define SCREEN_SIMD_TARGET(ISA)
+#endif
 
 // Format of the target visual
 static VisualFormat visualFormat;
@@ -35,6 +47,42 @@ static VisualFormat visualFormat;
 // This holds the pixels values of the palette colors for 8->16/32-bit expansion
 uint32 ExpandMap[256];
 
+/* -------------------------------------------------------------------------- */
+/* --- Vector instruction sets                                            --- */
+/* -------------------------------------------------------------------------- */
+
+// Return the best instruction set supported by this CPU
+static int Screen_cpu_simd_level(void)
+{
+#if defined(HAVE_SCREEN_SIMD) && defined(__GNUC__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return SCREEN_SIMD_AVX2;
+	if (__builtin_cpu_supports("ssse3"))
+		return SCREEN_SIMD_SSSE3;
+	if (__builtin_cpu_supports("sse2"))
+		return SCREEN_SIMD_SSE2;
+#elif defined(HAVE_SCREEN_SIMD)
+	int regs[4];
+	__cpuid(regs, 0);
+	const int max_leaf = regs[0];
+	__cpuid(regs, 1);
+	const int ecx1 = regs[2], edx1 = regs[3];
+	if (max_leaf >= 7 && (ecx1 & (1 << 27)) && (_xgetbv(0) & 6) == 6) {	// OS saves YMM registers?
+		__cpuidex(regs, 7, 0);
+		if (regs[1] & (1 << 5))
+			return SCREEN_SIMD_AVX2;
+	}
+	if (ecx1 & (1 << 9))
+		return SCREEN_SIMD_SSSE3;
+	if (edx1 & (1 << 26))
+		return SCREEN_SIMD_SSE2;
+#endif
+	return SCREEN_SIMD_NONE;
+}
+
+int Screen_simd_level = Screen_cpu_simd_level();
+
 // Mark video_blit.h for specialization
 #define DEFINE_VIDEO_BLITTERS 1
 
@@ -377,14 +425,14 @@ static void Blit_Expand_1_To_16(uint8 * dest, const uint8 * p, uint32 length)
 	uint16 *q = (uint16 *)dest;
 	for (uint32 i=0; i<length; i++) {
 		uint8 c = *p++;
-		*q++ = -(c >> 7);
-		*q++ = -((c >> 6) & 1);
-		*q++ = -((c >> 5) & 1);
-		*q++ = -((c >> 4) & 1);
-		*q++ = -((c >> 3) & 1);
-		*q++ = -((c >> 2) & 1);
-		*q++ = -((c >> 1) & 1);
-		*q++ = -(c & 1);
+		*q++ = ExpandMap[c >> 7];
+		*q++ = ExpandMap[(c >> 6) & 1];
+		*q++ = ExpandMap[(c >> 5) & 1];
+		*q++ = ExpandMap[(c >> 4) & 1];
+		*q++ = ExpandMap[(c >> 3) & 1];
+		*q++ = ExpandMap[(c >> 2) & 1];
+		*q++ = ExpandMap[(c >> 1) & 1];
+		*q++ = ExpandMap[c & 1];
 	}
 }
 
@@ -394,9 +442,9 @@ static void Blit_Expand_2_To_16(uint8 * dest, const uint8 * p, uint32 length)
 	for (uint32 i=0; i<length; i++) {
 		uint8 c = *p++;
 		*q++ = ExpandMap[c >> 6];
-		*q++ = ExpandMap[c >> 4];
-		*q++ = ExpandMap[c >> 2];
-		*q++ = ExpandMap[c];
+		*q++ = ExpandMap[(c >> 4) & 3];
+		*q++ = ExpandMap[(c >> 2) & 3];
+		*q++ = ExpandMap[c & 3];
 	}
 }
 
@@ -406,7 +454,7 @@ static void Blit_Expand_4_To_16(uint8 * dest, const uint8 * p, uint32 length)
 	for (uint32 i=0; i<length; i++) {
 		uint8 c = *p++;
 		*q++ = ExpandMap[c >> 4];
-		*q++ = ExpandMap[c];
+		*q++ = ExpandMap[c & 0x0f];
 	}
 }
 
@@ -426,14 +474,14 @@ static void Blit_Expand_1_To_32(uint8 * dest, const uint8 * p, uint32 length)
 	uint32 *q = (uint32 *)dest;
 	for (uint32 i=0; i<length; i++) {
 		uint8 c = *p++;
-		*q++ = -(c >> 7);
-		*q++ = -((c >> 6) & 1);
-		*q++ = -((c >> 5) & 1);
-		*q++ = -((c >> 4) & 1);
-		*q++ = -((c >> 3) & 1);
-		*q++ = -((c >> 2) & 1);
-		*q++ = -((c >> 1) & 1);
-		*q++ = -(c & 1);
+		*q++ = ExpandMap[c >> 7];
+		*q++ = ExpandMap[(c >> 6) & 1];
+		*q++ = ExpandMap[(c >> 5) & 1];
+		*q++ = ExpandMap[(c >> 4) & 1];
+		*q++ = ExpandMap[(c >> 3) & 1];
+		*q++ = ExpandMap[(c >> 2) & 1];
+		*q++ = ExpandMap[(c >> 1) & 1];
+		*q++ = ExpandMap[c & 1];
 	}
 }
 
@@ -443,9 +491,9 @@ static void Blit_Expand_2_To_32(uint8 * dest, const uint8 * p, uint32 length)
 	for (uint32 i=0; i<length; i++) {
 		uint8 c = *p++;
 		*q++ = ExpandMap[c >> 6];
-		*q++ = ExpandMap[c >> 4];
-		*q++ = ExpandMap[c >> 2];
-		*q++ = ExpandMap[c];
+		*q++ = ExpandMap[(c >> 4) & 3];
+		*q++ = ExpandMap[(c >> 2) & 3];
+		*q++ = ExpandMap[c & 3];
 	}
 }
 
@@ -455,7 +503,7 @@ static void Blit_Expand_4_To_32(uint8 * dest, const uint8 * p, uint32 length)
 	for (uint32 i=0; i<length; i++) {
 		uint8 c = *p++;
 		*q++ = ExpandMap[c >> 4];
-		*q++ = ExpandMap[c];
+		*q++ = ExpandMap[c & 0x0f];
 	}
 }
 
@@ -466,13 +514,294 @@ static void Blit_Expand_8_To_32(uint8 * dest, const uint8 * p, uint32 length)
 		*q++ = ExpandMap[*p++];
 }
 
+/* -------------------------------------------------------------------------- */
+/* --- Table driven indexed mode expansion                                --- */
+/* -------------------------------------------------------------------------- */
+
+// The expansion blitters above produce a fixed number of output bytes for
+// each source byte. Their output for all 256 source bytes is precomputed
+// in a table, which is rebuilt whenever ExpandMap changes, so that lines
+// can be expanded by copying one table entry per source byte.
+typedef void (*Screen_blit_func)(uint8 * dest, const uint8 * source, uint32 length);
+
+static const int EXPAND_MAX_ENTRY = 32;	// 8 pixels of 32 bits
+
+#if defined(__GNUC__)
+static uint8 expand_table[256 * EXPAND_MAX_ENTRY] __attribute__((aligned(32)));
+#elif defined(_MSC_VER)
+__declspec(align(32)) static uint8 expand_table[256 * EXPAND_MAX_ENTRY];
+#else
+static uint8 expand_table[256 * EXPAND_MAX_ENTRY];
+#endif
+static Screen_blit_func expand_handler = NULL;	// Blitter tabulated in expand_table
+static int expand_entry_size = 0;				// Output bytes per source byte
+
+template <int ENTRY>
+static void Blit_Expand_Table(uint8 * dest, const uint8 * p, uint32 length)
+{
+	for (uint32 i = 0; i < length; i++) {
+		memcpy(dest, expand_table + p[i] * ENTRY, ENTRY);
+		dest += ENTRY;
+	}
+}
+
+#ifdef HAVE_SCREEN_SIMD
+// Expand 8 source bytes at a time, gathering 4-byte table entries
+SCREEN_SIMD_TARGET("avx2")
+static void Blit_Expand_Table_4_AVX2(uint8 * dest, const uint8 * p, uint32 length)
+{
+	uint32 i = 0;
+	for (; i + 8 <= length; i += 8) {
+		const __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)(p + i)));
+		_mm256_storeu_si256((__m256i *)(dest + i * 4), _mm256_i32gather_epi32((const int *)expand_table, index, 4));
+	}
+	if (i < length)
+		Blit_Expand_Table<4>(dest + i * 4, p + i, length - i);
+}
+
+// Expand 4 source bytes at a time, gathering 8-byte table entries
+SCREEN_SIMD_TARGET("avx2")
+static void Blit_Expand_Table_8_AVX2(uint8 * dest, const uint8 * p, uint32 length)
+{
+	uint32 i = 0;
+	for (; i + 4 <= length; i += 4) {
+		int bytes;
+		memcpy(&bytes, p + i, 4);
+		const __m128i index = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes));
+		_mm256_storeu_si256((__m256i *)(dest + i * 8), _mm256_i32gather_epi64((const long long *)expand_table, index, 8));
+	}
+	if (i < length)
+		Blit_Expand_Table<8>(dest + i * 8, p + i, length - i);
+}
+#endif
+
+// Tabulate the expansion blitter HANDLER, return the table driven blitter
+static Screen_blit_func Screen_expand_select(Screen_blit_func handler, int entry_size)
+{
+	expand_handler = handler;
+	expand_entry_size = entry_size;
+	Screen_expand_map_changed();
+
+	switch (entry_size) {
+	case 2:
+		return Blit_Expand_Table<2>;
+	case 4:
+#ifdef HAVE_SCREEN_SIMD
+		if (Screen_simd_level >= SCREEN_SIMD_AVX2)
+			return Blit_Expand_Table_4_AVX2;
+#endif
+		return Blit_Expand_Table<4>;
+	case 8:
+#ifdef HAVE_SCREEN_SIMD
+		if (Screen_simd_level >= SCREEN_SIMD_AVX2)
+			return Blit_Expand_Table_8_AVX2;
+#endif
+		return Blit_Expand_Table<8>;
+	case 16:
+		return Blit_Expand_Table<16>;
+	case 32:
+		return Blit_Expand_Table<32>;
+	}
+	expand_handler = NULL;
+	return handler;
+}
+
+// Rebuild the expansion table after a change to ExpandMap
+void Screen_expand_map_changed(void)
+{
+	if (expand_handler == NULL)
+		return;
+	for (int c = 0; c < 256; c++) {
+		const uint8 byte = c;
+		expand_handler(expand_table + c * expand_entry_size, &byte, 1);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+/* --- Vector versions of the RGB converters                              --- */
+/* -------------------------------------------------------------------------- */
+
+#ifdef HAVE_SCREEN_SIMD
+
+// One term of a vector blitter: shift 32-bit words (to the left if
+// positive), then mask them
+template <int SHIFT, uint32 MASK>
+SCREEN_SIMD_TARGET("sse2")
+static inline __m128i Blit_Term_SSE2(__m128i v)
+{
+	if (MASK == 0)
+		return _mm_setzero_si128();
+	if (SHIFT > 0)
+		v = _mm_slli_epi32(v, SHIFT);
+	else if (SHIFT < 0)
+		v = _mm_srli_epi32(v, -SHIFT);
+	return _mm_and_si128(v, _mm_set1_epi32(MASK));
+}
+
+template <int SHIFT, uint32 MASK>
+SCREEN_SIMD_TARGET("avx2")
+static inline __m256i Blit_Term_AVX2(__m256i v)
+{
+	if (MASK == 0)
+		return _mm256_setzero_si256();
+	if (SHIFT > 0)
+		v = _mm256_slli_epi32(v, SHIFT);
+	else if (SHIFT < 0)
+		v = _mm256_srli_epi32(v, -SHIFT);
+	return _mm256_and_si256(v, _mm256_set1_epi32(MASK));
+}
+
+// Vector blitter computing each 32-bit word of output as the OR of up to
+// four terms of the input word, with SCALAR handling the end of a line
+template <void (*SCALAR)(uint8 *, const uint8 *, uint32), int S0, uint32 M0, int S1, uint32 M1, int S2, uint32 M2, int S3, uint32 M3>
+struct Blit_Terms {
+	SCREEN_SIMD_TARGET("sse2")
+	static void blit_sse2(uint8 * dest, const uint8 * source, uint32 length)
+	{
+		uint32 i = 0;
+		for (; i + 16 <= length; i += 16) {
+			const __m128i v = _mm_loadu_si128((const __m128i *)(source + i));
+			const __m128i d = _mm_or_si128(
+				_mm_or_si128(Blit_Term_SSE2<S0, M0>(v), Blit_Term_SSE2<S1, M1>(v)),
+				_mm_or_si128(Blit_Term_SSE2<S2, M2>(v), Blit_Term_SSE2<S3, M3>(v)));
+			_mm_storeu_si128((__m128i *)(dest + i), d);
+		}
+		if (i < length)
+			SCALAR(dest + i, source + i, length - i);
+	}
+
+	SCREEN_SIMD_TARGET("avx2")
+	static void blit_avx2(uint8 * dest, const uint8 * source, uint32 length)
+	{
+		uint32 i = 0;
+		for (; i + 32 <= length; i += 32) {
+			const __m256i v = _mm256_loadu_si256((const __m256i *)(source + i));
+			const __m256i d = _mm256_or_si256(
+				_mm256_or_si256(Blit_Term_AVX2<S0, M0>(v), Blit_Term_AVX2<S1, M1>(v)),
+				_mm256_or_si256(Blit_Term_AVX2<S2, M2>(v), Blit_Term_AVX2<S3, M3>(v)));
+			_mm256_storeu_si256((__m256i *)(dest + i), d);
+		}
+		if (i < length)
+			blit_sse2(dest + i, source + i, length - i);
+	}
+};
+
+// The RGB converters above, as seen by a little-endian host: each 32-bit
+// word of output is the OR of up to four copies of the input word, each
+// shifted (to the left if positive) and then masked
+struct Screen_blit_simd_info {
+	Screen_blit_func	handler;		// Scalar version
+	int					shift[4];		// Shift count of each term
+	uint32				mask[4];		// Mask of each term (0: unused)
+	Screen_blit_func	handler_sse2;	// SSE2 version
+	Screen_blit_func	handler_avx2;	// AVX2 version
+	int					max_level;		// Fastest instruction set (see blitbench)
+};
+
+#define SIMD_BLITTER(NAME, S0, M0, S1, M1, S2, M2, S3, M3, LEVEL) \
+	{ NAME, { S0, S1, S2, S3 }, { M0, M1, M2, M3 }, \
+	  Blit_Terms<NAME, S0, M0, S1, M1, S2, M2, S3, M3>::blit_sse2, \
+	  Blit_Terms<NAME, S0, M0, S1, M1, S2, M2, S3, M3>::blit_avx2, \
+	  SCREEN_SIMD_##LEVEL }
+
+// Full frames are mostly limited by memory bandwidth, where the wider
+// versions often lose to narrower ones, or to the scalar loop
+static const Screen_blit_simd_info Screen_blit_simd_table[] = {
+	SIMD_BLITTER(Blit_RGB555_NBO,  -8, 0x00ff00ff,  8, 0xff00ff00,   0, 0,           0, 0,          SSE2 ),
+	SIMD_BLITTER(Blit_BGR555_NBO,  -2, 0x001f001f, -8, 0x00e000e0,   8, 0x03000300,  2, 0x7c007c00, AVX2 ),
+	SIMD_BLITTER(Blit_BGR555_OBO,   6, 0x1f001f00,  0, 0xe003e003,  -6, 0x007c007c,  0, 0,          SSE2 ),
+	SIMD_BLITTER(Blit_RGB565_NBO,  -8, 0x001f001f,  9, 0xfe00fe00,  -7, 0x01c001c0,  0, 0,          SSE2 ),
+	SIMD_BLITTER(Blit_RGB565_OBO,   0, 0x1f001f00,  1, 0xe0fee0fe, -15, 0x00010001,  0, 0,          SSE2 ),
+	SIMD_BLITTER(Blit_RGB888_NBO, -24, 0x000000ff, -8, 0x0000ff00,   8, 0x00ff0000, 24, 0xff000000, SSSE3),
+	SIMD_BLITTER(Blit_BGR888_NBO,   0, 0x00ff00ff, 16, 0xff000000,   0, 0,           0, 0,          NONE ),
+	SIMD_BLITTER(Blit_BGR888_OBO, -16, 0x000000ff,  0, 0x00ff0000,  16, 0x00ff0000,  0, 0,          SSE2 ),
+};
+
+#undef SIMD_BLITTER
+
+// Converters that only move whole bytes use PSHUFB instead
+static struct {
+	Screen_blit_func	handler;		// Scalar version, for the end of a line
+	uint8				control[16];	// PSHUFB control
+} simd_shuffle;
+
+SCREEN_SIMD_TARGET("ssse3")
+static void Blit_Shuffle_SSSE3(uint8 * dest, const uint8 * source, uint32 length)
+{
+	const __m128i control = _mm_loadu_si128((const __m128i *)simd_shuffle.control);
+	uint32 i = 0;
+	for (; i + 16 <= length; i += 16)
+		_mm_storeu_si128((__m128i *)(dest + i), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(source + i)), control));
+	if (i < length)
+		simd_shuffle.handler(dest + i, source + i, length - i);
+}
+
+SCREEN_SIMD_TARGET("avx2")
+static void Blit_Shuffle_AVX2(uint8 * dest, const uint8 * source, uint32 length)
+{
+	const __m256i control = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)simd_shuffle.control));
+	uint32 i = 0;
+	for (; i + 32 <= length; i += 32)
+		_mm256_storeu_si256((__m256i *)(dest + i), _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(source + i)), control));
+	if (i < length)
+		Blit_Shuffle_SSSE3(dest + i, source + i, length - i);
+}
+
+// Compute the PSHUFB control for terms that only move whole bytes
+static bool Screen_blit_simd_shuffle(Screen_blit_simd_info const & info, uint8 * control)
+{
+	int from[4] = { -1, -1, -1, -1 };	// Source byte of each output byte (-1: zero)
+	bool written[4] = { false, false, false, false };
+	for (int t = 0; t < 4; t++) {
+		if (info.mask[t] == 0)
+			continue;
+		if (info.shift[t] % 8 != 0)
+			return false;
+		for (int b = 0; b < 4; b++) {
+			const uint32 m = (info.mask[t] >> (b * 8)) & 0xff;
+			if (m == 0)
+				continue;
+			if (m != 0xff || written[b])
+				return false;
+			written[b] = true;
+			const int s = b - info.shift[t] / 8;
+			from[b] = (s >= 0 && s < 4) ? s : -1;
+		}
+	}
+	for (int i = 0; i < 16; i++)
+		control[i] = from[i % 4] < 0 ? 0x80 : (i & ~3) + from[i % 4];
+	return true;
+}
+
+// Return the fastest version of a blitter for this CPU, or the blitter itself
+static Screen_blit_func Screen_blit_simd_select(Screen_blit_func handler)
+{
+	const int table_count = sizeof(Screen_blit_simd_table)/sizeof(Screen_blit_simd_table[0]);
+	for (int i = 0; i < table_count; i++) {
+		Screen_blit_simd_info const & info = Screen_blit_simd_table[i];
+		if (info.handler != handler)
+			continue;
+
+		const int level = Screen_simd_level < info.max_level ? Screen_simd_level : info.max_level;
+		if (level < SCREEN_SIMD_SSE2)
+			return handler;
+		if (level >= SCREEN_SIMD_SSSE3 && Screen_blit_simd_shuffle(info, simd_shuffle.control)) {
+			simd_shuffle.handler = handler;
+			return level >= SCREEN_SIMD_AVX2 ? Blit_Shuffle_AVX2 : Blit_Shuffle_SSSE3;
+		}
+		return level >= SCREEN_SIMD_AVX2 ? info.handler_avx2 : info.handler_sse2;
+	}
+	return handler;
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 /* --- Blitters to the host frame buffer, or XImage buffer                --- */
 /* -------------------------------------------------------------------------- */
 
 // Function used to update the hosst frame buffer (DGA), or an XImage buffer (WIN)
 // --> Shall be initialized only through the Screen_blitter_init() function
-typedef void (*Screen_blit_func)(uint8 * dest, const uint8 * source, uint32 length);
 Screen_blit_func Screen_blit = 0;
 
 // Structure used to match the adequate framebuffer update function
@@ -554,6 +883,7 @@ bool Screen_blitter_init(VisualFormat const & visual_format, bool native_byte_or
 
 		// 1/2/4/8-bit mode on 8/16/32-bit screen?
 		Screen_blit = NULL;
+		expand_handler = NULL;
 		switch (visualFormat.depth) {
 		case 8:
 			switch (mac_depth) {
@@ -582,6 +912,10 @@ bool Screen_blitter_init(VisualFormat const & visual_format, bool native_byte_or
 			break;
 		}
 		bool blitter_found = (Screen_blit != NULL);
+		if (blitter_found) {
+			const int host_bytes = visualFormat.depth == 8 ? 1 : visualFormat.depth <= 16 ? 2 : 4;
+			Screen_blit = Screen_expand_select(Screen_blit, host_bytes * 8 / mac_depth);
+		}
 	
 		// Search for an adequate blit function
 		const int blitters_count = sizeof(Screen_blitters)/sizeof(Screen_blitters[0]);
@@ -609,6 +943,11 @@ bool Screen_blitter_init(VisualFormat const & visual_format, bool native_byte_or
 				visualFormat.Rshift, visualFormat.Gshift, visualFormat.Bshift);
 			abort();
 		}
+
+#ifdef HAVE_SCREEN_SIMD
+		// Use a vector version of the blitter, if there is one
+		Screen_blit = Screen_blit_simd_select(Screen_blit);
+#endif
 	}
 #else
 	if (use_sdl_video && 1 == mac_depth && 8 == visual_format.depth) {
@@ -627,3 +966,87 @@ bool Screen_blitter_init(VisualFormat const & visual_format, bool native_byte_or
 	// --> In that case, we return FALSE
 	return (Screen_blit != Blit_Copy_Raw);
 }
+
+
+/* -------------------------------------------------------------------------- */
+/* --- Frame buffer comparison                                            --- */
+/* -------------------------------------------------------------------------- */
+
+// Compare ROWS rows of LENGTH bytes, PITCH bytes apart, return true if any byte differs
+typedef bool (*Screen_tile_differs_func)(const uint8 * a, const uint8 * b, uint32 length, uint32 rows, uint32 pitch);
+
+static bool Screen_tile_differs_init(const uint8 * a, const uint8 * b, uint32 length, uint32 rows, uint32 pitch);
+Screen_tile_differs_func Screen_tile_differs = Screen_tile_differs_init;
+
+// Compare the tail of a row that is too short for a vector
+static inline bool Screen_row_tail_differs(const uint8 * a, const uint8 * b, uint32 i, uint32 length)
+{
+	for (; i + 8 <= length; i += 8) {
+		uint64 x, y;
+		memcpy(&x, a + i, 8);
+		memcpy(&y, b + i, 8);
+		if (x != y)
+			return true;
+	}
+	for (; i < length; i++) {
+		if (a[i] != b[i])
+			return true;
+	}
+	return false;
+}
+
+static bool Screen_tile_differs_generic(const uint8 * a, const uint8 * b, uint32 length, uint32 rows, uint32 pitch)
+{
+	for (uint32 j = 0; j < rows; j++, a += pitch, b += pitch) {
+		if (Screen_row_tail_differs(a, b, 0, length))
+			return true;
+	}
+	return false;
+}
+
+#ifdef HAVE_SCREEN_SIMD
+SCREEN_SIMD_TARGET("sse2")
+static bool Screen_tile_differs_sse2(const uint8 * a, const uint8 * b, uint32 length, uint32 rows, uint32 pitch)
+{
+	for (uint32 j = 0; j < rows; j++, a += pitch, b += pitch) {
+		__m128i d = _mm_setzero_si128();
+		uint32 i = 0;
+		for (; i + 16 <= length; i += 16)
+			d = _mm_or_si128(d, _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i)), _mm_loadu_si128((const __m128i *)(b + i))));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(d, _mm_setzero_si128())) != 0xffff)
+			return true;
+		if (i < length && Screen_row_tail_differs(a, b, i, length))
+			return true;
+	}
+	return false;
+}
+
+SCREEN_SIMD_TARGET("avx2")
+static bool Screen_tile_differs_avx2(const uint8 * a, const uint8 * b, uint32 length, uint32 rows, uint32 pitch)
+{
+	for (uint32 j = 0; j < rows; j++, a += pitch, b += pitch) {
+		__m256i d = _mm256_setzero_si256();
+		uint32 i = 0;
+		for (; i + 32 <= length; i += 32)
+			d = _mm256_or_si256(d, _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a + i)), _mm256_loadu_si256((const __m256i *)(b + i))));
+		if (!_mm256_testz_si256(d, d))
+			return true;
+		if (i < length && Screen_row_tail_differs(a, b, i, length))
+			return true;
+	}
+	return false;
+}
+#endif
+
+// Select the comparison function for this CPU on first use
+static bool Screen_tile_differs_init(const uint8 * a, const uint8 * b, uint32 length, uint32 rows, uint32 pitch)
+{
+	Screen_tile_differs = Screen_tile_differs_generic;
+#ifdef HAVE_SCREEN_SIMD
+	if (Screen_simd_level >= SCREEN_SIMD_AVX2)
+		Screen_tile_differs = Screen_tile_differs_avx2;
+	else if (Screen_simd_level >= SCREEN_SIMD_SSE2)
+		Screen_tile_differs = Screen_tile_differs_sse2;
+#endif
+	return Screen_tile_differs(a, b, length, rows, pitch);
+}
@@ -34,7 +34,18 @@ struct VisualFormat {
 // Prototypes
 extern void (*Screen_blit)(uint8 * dest, const uint8 * source, uint32 length);
 extern bool Screen_blitter_init(VisualFormat const & visual_format, bool native_byte_order, int mac_depth);
+extern bool (*Screen_tile_differs)(const uint8 * a, const uint8 * b, uint32 length, uint32 rows, uint32 pitch);
 extern uint32 ExpandMap[256];
+extern void Screen_expand_map_changed(void);	// Call after changing ExpandMap
+
+// Vector instruction sets used by the blitters
+enum {
+	SCREEN_SIMD_NONE,
+	SCREEN_SIMD_SSE2,
+	SCREEN_SIMD_SSSE3,
+	SCREEN_SIMD_AVX2
+};
+extern int Screen_simd_level;	// Best one Screen_blitter_init() may use, initially what the CPU supports
 
 // Glue for SheepShaver and BasiliskII
 #ifdef SHEEPSHAVER
@@ -100,6 +100,9 @@ struct ScreenInfo {
 	bool very_dirty;			// Flag: set if the frame buffer was completely modified (e.g. colormap changes)
     char * dirtyPages;			// Table of flags set if page was altered
     ScreenPageInfo * pageInfo;	// Table of mappings page -> Mac scanlines
+
+	bool write_watch;			// Flag: pages are tracked by vm_get_write_watch() instead of faults
+	void ** watchPages;			// Buffer for the pages returned by vm_get_write_watch()
 };
 
 static ScreenInfo mainBuffer;
@@ -235,6 +238,15 @@ static bool video_vosf_profitable(uint32 *duration_p = NULL, uint32 *n_page_faul
 	uint32 n_tries = VOSF_PROFITABLE_TRIES;
 	const uint32 n_page_faults = mainBuffer.pageCount * n_tries;
 
+	// Write tracking by the host doesn't fault at all
+	if (mainBuffer.write_watch) {
+		if (duration_p)
+			*duration_p = 0;
+		if (n_page_faults_p)
+			*n_page_faults_p = 0;
+		return true;
+	}
+
 #ifdef SHEEPSHAVER
 	const bool accel = PrefsFindBool("gfxaccel");
 #else
@@ -323,8 +335,19 @@ static bool video_vosf_init(MONITOR_INIT)
 			a = mainBuffer.memLength;
 	}
 	
+	// Use the write-tracking state of the host if the frame buffer was
+	// allocated with VM_MAP_WRITE_WATCH, polled once per refresh
+	mainBuffer.write_watch = false;
+	if (vm_reset_write_watch((char *)mainBuffer.memStart, mainBuffer.memLength) == 0) {
+		mainBuffer.watchPages = (void **) malloc(mainBuffer.pageCount * sizeof(void *));
+		if (mainBuffer.watchPages == NULL)
+			return false;
+		mainBuffer.write_watch = true;
+		D(bug("VOSF uses write watch\n"));
+	}
+
 	// We can now write-protect the frame buffer
-	if (vm_protect((char *)mainBuffer.memStart, mainBuffer.memLength, VM_PAGE_READ) != 0)
+	else if (vm_protect((char *)mainBuffer.memStart, mainBuffer.memLength, VM_PAGE_READ) != 0)
 		return false;
 	
 	// The frame buffer is sane, i.e. there is no write to it yet
@@ -347,6 +370,33 @@ static void video_vosf_exit(void)
 		free(mainBuffer.dirtyPages);
 		mainBuffer.dirtyPages = NULL;
 	}
+	if (mainBuffer.watchPages) {
+		free(mainBuffer.watchPages);
+		mainBuffer.watchPages = NULL;
+	}
+	mainBuffer.write_watch = false;
+}
+
+
+/*
+ * Mark the pages written to since the last call dirty (write watch mode)
+ * and tell whether the frame buffer needs to be updated
+ */
+
+static bool vosf_check_dirty(void)
+{
+	if (mainBuffer.write_watch) {
+		unsigned int n_pages = mainBuffer.pageCount;
+		LOCK_VOSF;
+		if (vm_get_write_watch((char *)mainBuffer.memStart, mainBuffer.memLength, mainBuffer.watchPages, &n_pages, VM_WRITE_WATCH_RESET) == 0) {
+			for (unsigned int i = 0; i < n_pages; i++)
+				PFLAG_SET(((uintptr)mainBuffer.watchPages[i] - mainBuffer.memStart) >> mainBuffer.pageBits);
+			if (n_pages)
+				mainBuffer.dirty = true;
+		}
+		UNLOCK_VOSF;
+	}
+	return mainBuffer.dirty;
 }
 
 
@@ -362,7 +412,8 @@ static void vosf_do_set_dirty_area(uintptr first, uintptr last)
 	for (int i = first_page; i <= last_page; i++) {
 		if (PFLAG_ISCLEAR(i)) {
 			PFLAG_SET(i);
-			vm_protect(addr, mainBuffer.pageSize, VM_PAGE_READ | VM_PAGE_WRITE);
+			if (!mainBuffer.write_watch)
+				vm_protect(addr, mainBuffer.pageSize, VM_PAGE_READ | VM_PAGE_WRITE);
 		}
 		addr += mainBuffer.pageSize;
 	}
@@ -500,7 +551,8 @@ static void update_display_window_vosf(VIDEO_DRV_WIN_INIT)
 		// Make the dirty pages read-only again
 		const int32 offset  = first_page << mainBuffer.pageBits;
 		const uint32 length = (page - first_page) << mainBuffer.pageBits;
-		vm_protect((char *)mainBuffer.memStart + offset, length, VM_PAGE_READ);
+		if (!mainBuffer.write_watch)
+			vm_protect((char *)mainBuffer.memStart + offset, length, VM_PAGE_READ);
 		
 		// There is at least one line to update
 		const int y1 = mainBuffer.pageInfo[first_page].top;
@@ -555,7 +607,8 @@ static void update_display_dga_vosf(VIDEO_DRV_DGA_INIT)
 	// Full screen update requested?
 	if (mainBuffer.very_dirty) {
 		PFLAG_CLEAR_ALL;
-		vm_protect((char *)mainBuffer.memStart, mainBuffer.memLength, VM_PAGE_READ);
+		if (!mainBuffer.write_watch)
+			vm_protect((char *)mainBuffer.memStart, mainBuffer.memLength, VM_PAGE_READ);
 		memcpy(the_buffer_copy, the_buffer, VIDEO_MODE_ROW_BYTES * VIDEO_MODE_Y);
 		VIDEO_DRV_LOCK_PIXELS;
 		int i1 = 0, i2 = 0;
@@ -595,7 +648,8 @@ static void update_display_dga_vosf(VIDEO_DRV_DGA_INIT)
 		// Make the dirty pages read-only again
 		const int32 offset  = first_page << mainBuffer.pageBits;
 		const uint32 length = (page - first_page) << mainBuffer.pageBits;
-		vm_protect((char *)mainBuffer.memStart + offset, length, VM_PAGE_READ);
+		if (!mainBuffer.write_watch)
+			vm_protect((char *)mainBuffer.memStart + offset, length, VM_PAGE_READ);
 
 		// Optimized for scanlines, don't process overlapping lines again
 		uint32 y1 = mainBuffer.pageInfo[first_page].top;
@@ -32,6 +32,15 @@
 #include <windows.h>
 #endif
 
+#if defined(HAVE_MMAP_VM) && defined(HAVE_LINUX_USERFAULTFD_H)
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+#include <linux/userfaultfd.h>
+#define HAVE_LINUX_WRITE_WATCH 1
+#define HAVE_VM_WRITE_WATCH 1
+#endif
+
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -109,6 +118,96 @@ static int zero_fd	= -1;
 #endif
 #endif
 
+/* Linux write watch: asynchronous userfaultfd write-protection (Linux
+   6.7+) makes the kernel resolve write faults to registered pages by
+   itself, only recording that the page was written to. PAGEMAP_SCAN
+   then collects and write-protects again the written pages in a single
+   call, without any signal or page table walk on our side. The
+   definitions are repeated here for older kernel headers.  */
+
+#ifdef HAVE_LINUX_WRITE_WATCH
+#ifndef UFFD_USER_MODE_ONLY
+#define UFFD_USER_MODE_ONLY		1
+#endif
+#ifndef UFFD_FEATURE_WP_UNPOPULATED
+#define UFFD_FEATURE_WP_UNPOPULATED	(1 << 13)
+#endif
+#ifndef UFFD_FEATURE_WP_ASYNC
+#define UFFD_FEATURE_WP_ASYNC		(1 << 15)
+#endif
+#ifndef PAGEMAP_SCAN
+#define PAGE_IS_WRITTEN			(1 << 1)
+#define PM_SCAN_WP_MATCHING		(1 << 0)
+#define PM_SCAN_CHECK_WPASYNC	(1 << 1)
+struct page_region {
+	__u64 start;
+	__u64 end;
+	__u64 categories;
+};
+struct pm_scan_arg {
+	__u64 size;
+	__u64 flags;
+	__u64 start;
+	__u64 end;
+	__u64 walk_end;
+	__u64 vec;
+	__u64 vec_len;
+	__u64 max_pages;
+	__u64 category_inverted;
+	__u64 category_mask;
+	__u64 category_anyof_mask;
+	__u64 return_mask;
+};
+#define PAGEMAP_SCAN			_IOWR('f', 16, struct pm_scan_arg)
+#endif
+
+static int write_watch_uffd = -1;		// userfaultfd descriptor all tracked ranges are registered with
+static int write_watch_pagemap = -1;	// /proc/self/pagemap descriptor to scan them
+
+static bool write_watch_init(void)
+{
+	static bool tried = false;
+	if (tried)
+		return write_watch_pagemap >= 0;
+	tried = true;
+
+	int fd = syscall(__NR_userfaultfd, O_CLOEXEC | O_NONBLOCK | UFFD_USER_MODE_ONLY);
+	if (fd < 0)
+		return false;
+	struct uffdio_api api;
+	memset(&api, 0, sizeof(api));
+	api.api = UFFD_API;
+	api.features = UFFD_FEATURE_WP_ASYNC | UFFD_FEATURE_WP_UNPOPULATED;
+	if (ioctl(fd, UFFDIO_API, &api) < 0) {
+		close(fd);
+		return false;
+	}
+	int pagemap = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+	if (pagemap < 0) {
+		close(fd);
+		return false;
+	}
+	write_watch_uffd = fd;
+	write_watch_pagemap = pagemap;
+	return true;
+}
+
+static int write_watch_register(void * addr, size_t size)
+{
+	if (!write_watch_init())
+		return -1;
+
+	struct uffdio_register reg;
+	memset(&reg, 0, sizeof(reg));
+	reg.range.start = (vm_uintptr_t)addr;
+	reg.range.len = size;
+	reg.mode = UFFDIO_REGISTER_MODE_WP;
+	if (ioctl(write_watch_uffd, UFFDIO_REGISTER, &reg) < 0)
+		return -1;
+	return vm_reset_write_watch(addr, size);
+}
+#endif
+
 /* Translate generic VM map flags to host values.  */
 
 #ifdef HAVE_MMAP_VM
@@ -267,6 +366,12 @@ void * vm_acquire(size_t size, int options)
 	// Sanity checks for 64-bit platforms
 	if (sizeof(void *) == 8 && (options & VM_MAP_32BIT) && !((char *)addr <= (char *)0xffffffff))
 		return VM_MAP_FAILED;
+#endif
+#ifdef HAVE_LINUX_WRITE_WATCH
+	if ((options & VM_MAP_WRITE_WATCH) && write_watch_register(addr, size) < 0) {
+		munmap((caddr_t)addr, size);
+		return VM_MAP_FAILED;
+	}
 #endif
 	next_address = (char *)addr + size;
 #elif defined(HAVE_WIN32_VM)
@@ -292,6 +397,83 @@ void * vm_acquire(size_t size, int options)
 	return addr;
 }
 
+/* Allocate zero-filled memory of SIZE bytes so that the whole region
+   lies within DISTANCE bytes of ANCHOR. Returns VM_MAP_FAILED if no
+   such region could be found.  */
+
+static inline bool vm_region_near(void * anchor, void * addr, size_t size, size_t distance)
+{
+	vm_uintptr_t a = (vm_uintptr_t)anchor;
+	vm_uintptr_t lo = (vm_uintptr_t)addr;
+	vm_uintptr_t hi = lo + size;
+	return (lo >= a || a - lo <= distance) && (hi <= a || hi - a <= distance);
+}
+
+void * vm_acquire_near(void * anchor, size_t size, size_t distance, int options)
+{
+	// Hints are probed every 64 MB, below the anchor first so that the
+	// program break stays free to grow above the image
+	const vm_uintptr_t step = 64 * 1024 * 1024;
+	const vm_uintptr_t a = (vm_uintptr_t)anchor & ~(step - 1);
+
+	if (options & (VM_MAP_FIXED | VM_MAP_SHARED))
+		return VM_MAP_FAILED;
+
+	if (size >= distance)
+		return VM_MAP_FAILED;
+
+	// Nothing to do if the address space cannot be larger than the distance
+	if (sizeof(void *) == 4 && distance >= 0x80000000)
+		return vm_acquire(size, options);
+
+	for (vm_uintptr_t offset = 0; offset + size <= distance; offset += step) {
+		for (int dir = 0; dir < 2; dir++) {
+			vm_uintptr_t hint;
+			if (dir == 0) {
+				if (a < offset + size)
+					continue;
+				hint = (a - offset - size) & ~(step - 1);
+			}
+			else {
+				// Leave the first 256 MB above the image for the heap
+				hint = a + 4 * step + offset;
+				if (hint < a)
+					continue;
+			}
+			void * addr;
+#if defined(HAVE_MMAP_VM)
+			int the_map_flags = translate_map_flags(options) | (map_flags & ~MAP_32BIT);
+			if ((addr = mmap((caddr_t)hint, size, VM_PAGE_DEFAULT, the_map_flags, zero_fd, 0)) == (void *)MAP_FAILED)
+				return VM_MAP_FAILED;
+#elif defined(HAVE_WIN32_VM)
+			int alloc_type = MEM_RESERVE | MEM_COMMIT;
+			if (options & VM_MAP_WRITE_WATCH)
+				alloc_type |= MEM_WRITE_WATCH;
+			if ((addr = VirtualAlloc((LPVOID)hint, size, alloc_type, PAGE_EXECUTE_READWRITE)) == NULL)
+				continue;
+#else
+			// No way to pass a placement hint, take whatever we get
+			if ((addr = vm_acquire(size, options)) == VM_MAP_FAILED)
+				return VM_MAP_FAILED;
+			if (vm_region_near(anchor, addr, size, distance))
+				return addr;
+			vm_release(addr, size);
+			return VM_MAP_FAILED;
+#endif
+			if (vm_region_near(anchor, addr, size, distance)) {
+				if (vm_protect(addr, size, VM_PAGE_DEFAULT) != 0) {
+					vm_release(addr, size);
+					return VM_MAP_FAILED;
+				}
+				return addr;
+			}
+			vm_release(addr, size);
+		}
+	}
+
+	return VM_MAP_FAILED;
+}
+
 /* Allocate zero-filled memory at exactly ADDR (which must be page-aligned).
    Retuns 0 if successful, -1 on errors.  */
 
@@ -321,6 +503,10 @@ int vm_acquire_fixed(void * addr, size_t size, int options)
 
 	if (mmap((caddr_t)addr, size, VM_PAGE_DEFAULT, the_map_flags, fd, 0) == (void *)MAP_FAILED)
 		return -1;
+#ifdef HAVE_LINUX_WRITE_WATCH
+	if ((options & VM_MAP_WRITE_WATCH) && write_watch_register(addr, size) < 0)
+		return -1;
+#endif
 #elif defined(HAVE_WIN32_VM)
 	// Windows cannot allocate Low Memory
 	if (addr == NULL)
@@ -426,6 +612,41 @@ int vm_get_write_watch(void * addr, size_t size,
 	*n_pages = count;
 	return 0;
 #endif
+#ifdef HAVE_LINUX_WRITE_WATCH
+	if (write_watch_pagemap < 0)
+		return -1;
+
+	const vm_uintptr_t page_size = getpagesize();
+	const unsigned int max_pages = *n_pages;
+	unsigned int count = 0;
+
+	struct page_region regions[32];
+	struct pm_scan_arg arg;
+	memset(&arg, 0, sizeof(arg));
+	arg.size = sizeof(arg);
+	if (options & VM_WRITE_WATCH_RESET)
+		arg.flags = PM_SCAN_WP_MATCHING | PM_SCAN_CHECK_WPASYNC;
+	arg.start = (vm_uintptr_t)addr;
+	arg.end = (vm_uintptr_t)addr + size;
+	arg.vec = (vm_uintptr_t)regions;
+	arg.vec_len = sizeof(regions) / sizeof(regions[0]);
+	arg.category_mask = PAGE_IS_WRITTEN;
+	arg.return_mask = PAGE_IS_WRITTEN;
+	while (count < max_pages && arg.start < arg.end) {
+		arg.max_pages = max_pages - count;
+		int n_regions = ioctl(write_watch_pagemap, PAGEMAP_SCAN, &arg);
+		if (n_regions < 0)
+			return -1;
+		for (int i = 0; i < n_regions; i++) {
+			for (vm_uintptr_t p = regions[i].start; p < regions[i].end && count < max_pages; p += page_size)
+				pages[count++] = (void *)p;
+		}
+		arg.start = arg.walk_end;
+	}
+
+	*n_pages = count;
+	return 0;
+#endif
 #endif
 	// Unsupported
 	return -1;
@@ -441,6 +662,17 @@ int vm_reset_write_watch(void * addr, size_t size)
 	int ret_code = ResetWriteWatch(addr, size);
 	return ret_code == 0 ? 0 : -1;
 #endif
+#ifdef HAVE_LINUX_WRITE_WATCH
+	if (write_watch_uffd < 0)
+		return -1;
+
+	struct uffdio_writeprotect wp;
+	memset(&wp, 0, sizeof(wp));
+	wp.range.start = (vm_uintptr_t)addr;
+	wp.range.len = size;
+	wp.mode = UFFDIO_WRITEPROTECT_MODE_WP;
+	return ioctl(write_watch_uffd, UFFDIO_WRITEPROTECT, &wp) == 0 ? 0 : -1;
+#endif
 #endif
 	// Unsupported
 	return -1;
@@ -101,6 +101,13 @@ extern void * vm_acquire(size_t size, int options = VM_MAP_DEFAULT);
 
 extern void * vm_acquire_reserved(size_t size);
 
+/* Allocate zero-filled memory of SIZE bytes so that the whole region
+   lies within DISTANCE bytes of ANCHOR. This is useful to keep
+   generated code within reach of 32-bit displacements to the program
+   image. Returns VM_MAP_FAILED if no such region could be found.  */
+
+extern void * vm_acquire_near(void * anchor, size_t size, size_t distance, int options = VM_MAP_DEFAULT);
+
 /* Allocate zero-filled memory at exactly ADDR (which must be page-aligned).
    Returns 0 if successful, -1 on errors.  */
 
@@ -53,6 +53,9 @@ using std::string;
 #include "vm_alloc.h"
 #include "sigsegv.h"
 
+#if EMULATED_68K
+extern void predecode_flush(int); // from newcpu.cpp
+#endif
 #if USE_JIT
 extern void flush_icache_range(uint8 *start, uint32 size); // from compemu_support.cpp
 #endif
@@ -535,6 +538,10 @@ void FlushCodeCache(void *start, uint32 size)
 #if USE_JIT
 	if (UseJIT)
 		flush_icache_range((uint8 *)start, size);
+	else
+		predecode_flush(0);
+#elif EMULATED_68K
+	predecode_flush(0);
 #endif
 }
 
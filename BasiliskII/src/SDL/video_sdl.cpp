@@ -207,15 +207,19 @@ static void *vm_acquire_framebuffer(uint32 size)
 	// always try to reallocate framebuffer at the same address
 	static void *fb = VM_MAP_FAILED;
 	if (fb != VM_MAP_FAILED) {
-		if (vm_acquire_fixed(fb, size) < 0) {
+		if (vm_acquire_fixed(fb, size, VM_MAP_DEFAULT | VM_MAP_WRITE_WATCH) < 0 && vm_acquire_fixed(fb, size) < 0) {
 #ifndef SHEEPSHAVER
 			printf("FATAL: Could not reallocate framebuffer at previous address\n");
 #endif
 			fb = VM_MAP_FAILED;
 		}
 	}
-	if (fb == VM_MAP_FAILED)
-		fb = vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT);
+	if (fb == VM_MAP_FAILED) {
+		// Prefer memory the host tracks writes to, VOSF then needs no page faults
+		fb = vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT | VM_MAP_WRITE_WATCH);
+		if (fb == VM_MAP_FAILED)
+			fb = vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT);
+	}
 	return fb;
 }
 
@@ -714,9 +718,11 @@ void driver_base::adapt_to_video_mode() {
 	Screen_blitter_init(visualFormat, true, mac_depth_of_video_depth(VIDEO_MODE_DEPTH));
 
 	// Load gray ramp to 8->16/32 expand map
-	if (!IsDirectMode(mode))
+	if (!IsDirectMode(mode)) {
 		for (int i=0; i<256; i++)
 			ExpandMap[i] = SDL_MapRGB(f, i, i, i);
+		Screen_expand_map_changed();
+	}
 
 
 	bool hardware_cursor = false;
@@ -1434,6 +1440,7 @@ void SDL_monitor_desc::set_palette(uint8 *pal, int num_in)
 			int c = i & (num_in-1); // If there are less than 256 colors, we repeat the first entries (this makes color expansion easier)
 			ExpandMap[i] = SDL_MapRGB(drv->s->format, pal[c*3+0], pal[c*3+1], pal[c*3+2]);
 		}
+		Screen_expand_map_changed();
 
 #ifdef ENABLE_VOSF
 		if (use_vosf) {
@@ -2181,7 +2188,7 @@ static void video_refresh_dga_vosf(void)
 	static uint32 tick_counter = 0;
 	if (++tick_counter >= frame_skip) {
 		tick_counter = 0;
-		if (mainBuffer.dirty) {
+		if (vosf_check_dirty()) {
 			LOCK_VOSF;
 			update_display_dga_vosf(drv);
 			UNLOCK_VOSF;
@@ -2199,7 +2206,7 @@ static void video_refresh_window_vosf(void)
 	static uint32 tick_counter = 0;
 	if (++tick_counter >= frame_skip) {
 		tick_counter = 0;
-		if (mainBuffer.dirty) {
+		if (vosf_check_dirty()) {
 			LOCK_VOSF;
 			update_display_window_vosf(drv);
 			UNLOCK_VOSF;
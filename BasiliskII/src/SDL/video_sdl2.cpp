@@ -47,6 +47,8 @@
 #include <SDL_mutex.h>
 #include <SDL_thread.h>
 #include <errno.h>
+#include <limits.h>
+#include <algorithm>
 #include <vector>
 #include <string>
 
@@ -137,13 +139,18 @@ static int keycode_table[256];						// X keycode -> Mac keycode translation tabl
 
 // SDL variables
 SDL_Window * sdl_window = NULL;				        // Wraps an OS-native window
-static SDL_Surface * host_surface = NULL;			// Surface in host-OS display format
 static SDL_Surface * guest_surface = NULL;			// Surface in guest-OS display format
 static SDL_Renderer * sdl_renderer = NULL;			// Handle to SDL2 renderer
 static SDL_threadID sdl_renderer_thread_id = 0;		// Thread ID where the SDL_renderer was created, and SDL_renderer ops should run (for compatibility w/ d3d9)
 static SDL_Texture * sdl_texture = NULL;			// Handle to a GPU texture, with which to draw guest_surface to
-static SDL_Rect sdl_update_video_rect = {0,0,0,0};  // Union of all rects to update, when updating sdl_texture
-static SDL_mutex * sdl_update_video_mutex = NULL;   // Mutex to protect sdl_update_video_rect
+static const Uint32 sdl_texture_format = SDL_PIXELFORMAT_ARGB8888;	// Pixel format of sdl_texture
+static const int MAX_DAMAGE_RECTS = 16;				// Maximum number of separate texture uploads per frame
+static SDL_Rect sdl_damage_rects[MAX_DAMAGE_RECTS];	// Rects to update, when updating sdl_texture
+static int sdl_damage_count = 0;					// Number of valid entries in sdl_damage_rects
+static SDL_mutex * sdl_update_video_mutex = NULL;   // Mutex to protect sdl_damage_rects
+static uint64 sdl_present_frames = 0;				// Statistics: frames uploaded to sdl_texture
+static uint64 sdl_present_rects = 0;				// Statistics: rects uploaded to sdl_texture
+static uint64 sdl_present_bytes = 0;				// Statistics: bytes uploaded to sdl_texture
 static int screen_depth;							// Depth of current screen
 static SDL_Cursor *sdl_cursor = NULL;				// Copy of Mac cursor
 static SDL_Palette *sdl_palette = NULL;				// Color palette to be used as CLUT and gamma table
@@ -232,15 +239,19 @@ static void *vm_acquire_framebuffer(uint32 size)
 	// always try to reallocate framebuffer at the same address
 	static void *fb = VM_MAP_FAILED;
 	if (fb != VM_MAP_FAILED) {
-		if (vm_acquire_fixed(fb, size) < 0) {
+		if (vm_acquire_fixed(fb, size, VM_MAP_DEFAULT | VM_MAP_WRITE_WATCH) < 0 && vm_acquire_fixed(fb, size) < 0) {
 #ifndef SHEEPSHAVER
 			printf("FATAL: Could not reallocate framebuffer at previous address\n");
 #endif
 			fb = VM_MAP_FAILED;
 		}
 	}
-	if (fb == VM_MAP_FAILED)
-		fb = vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT);
+	if (fb == VM_MAP_FAILED) {
+		// Prefer memory the host tracks writes to, VOSF then needs no page faults
+		fb = vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT | VM_MAP_WRITE_WATCH);
+		if (fb == VM_MAP_FAILED)
+			fb = vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT);
+	}
 	return fb;
 #endif
 }
@@ -450,9 +461,11 @@ static int mac_depth_of_video_depth(int video_depth)
 }
 
 // Map video_mode depth ID to SDL screen depth
+// (indexed modes are expanded through ExpandMap into a 32-bit surface, in
+// the texture's format)
 static int sdl_depth_of_video_depth(int video_depth)
 {
-	return (video_depth <= VIDEO_DEPTH_8BIT) ? 8 : mac_depth_of_video_depth(video_depth);
+	return (video_depth <= VIDEO_DEPTH_8BIT) ? 32 : mac_depth_of_video_depth(video_depth);
 }
 
 // Get screen dimensions
@@ -680,15 +693,6 @@ static void delete_sdl_video_surfaces()
 		sdl_texture = NULL;
 	}
 	
-	if (host_surface) {
-		if (host_surface == guest_surface) {
-			guest_surface = NULL;
-		}
-		
-		SDL_FreeSurface(host_surface);
-		host_surface = NULL;
-	}
-	
 	if (guest_surface) {
 		SDL_FreeSurface(guest_surface);
 		guest_surface = NULL;
@@ -819,28 +823,20 @@ static SDL_Surface * init_sdl_video(int width, int height, int bpp, Uint32 flags
     }
 
 	SDL_assert(sdl_texture == NULL);
-    sdl_texture = SDL_CreateTexture(sdl_renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
+    sdl_texture = SDL_CreateTexture(sdl_renderer, sdl_texture_format, SDL_TEXTUREACCESS_STREAMING, width, height);
     if (!sdl_texture) {
         shutdown_sdl_video();
         return NULL;
     }
-    sdl_update_video_rect.x = 0;
-    sdl_update_video_rect.y = 0;
-    sdl_update_video_rect.w = 0;
-    sdl_update_video_rect.h = 0;
+    sdl_damage_count = 0;
 
 	SDL_assert(guest_surface == NULL);
-	SDL_assert(host_surface == NULL);
     switch (bpp) {
-        case 8:
-            guest_surface = SDL_CreateRGBSurface(0, width, height, 8, 0, 0, 0, 0);
-            break;
 		case 16:
 			guest_surface = SDL_CreateRGBSurface(0, width, height, 16, 0x0000F800, 0x000007E0, 0x0000001F, 0x00000000);
 			break;
         case 32:
             guest_surface = SDL_CreateRGBSurface(0, width, height, 32, 0x00FF0000, 0x0000FF00, 0x000000FF, 0xFF000000);
-            host_surface = guest_surface;
             break;
         default:
             printf("WARNING: An unsupported bpp of %d was used\n", bpp);
@@ -851,30 +847,6 @@ static SDL_Surface * init_sdl_video(int width, int height, int bpp, Uint32 flags
         return NULL;
     }
 
-    if (!host_surface) {
-    	Uint32 texture_format;
-    	if (SDL_QueryTexture(sdl_texture, &texture_format, NULL, NULL, NULL) != 0) {
-    		printf("ERROR: Unable to get the SDL texture's pixel format: %s\n", SDL_GetError());
-    		shutdown_sdl_video();
-    		return NULL;
-    	}
-
-    	int bpp;
-    	Uint32 Rmask, Gmask, Bmask, Amask;
-    	if (!SDL_PixelFormatEnumToMasks(texture_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask)) {
-    		printf("ERROR: Unable to determine format for host SDL_surface: %s\n", SDL_GetError());
-    		shutdown_sdl_video();
-    		return NULL;
-    	}
-
-        host_surface = SDL_CreateRGBSurface(0, width, height, bpp, Rmask, Gmask, Bmask, Amask);
-        if (!host_surface) {
-        	printf("ERROR: Unable to create host SDL_surface: %s\n", SDL_GetError());
-            shutdown_sdl_video();
-            return NULL;
-        }
-    }
-
 	if (SDL_RenderSetLogicalSize(sdl_renderer, width, height) != 0) {
 		printf("ERROR: Unable to set SDL rendeer's logical size (to %dx%d): %s\n",
 			   width, height, SDL_GetError());
@@ -887,9 +859,76 @@ static SDL_Surface * init_sdl_video(int width, int height, int bpp, Uint32 flags
     return guest_surface;
 }
 
+// Add a rect to the damage list, sdl_update_video_mutex must be held
+static void add_damage_rect(SDL_Rect r)
+{
+	// Damage tracking overhead of a separate upload, in pixels
+	const int MERGE_SLACK = 64 * 64;
+
+	if (SDL_RectEmpty(&r))
+		return;
+
+	// Merge with existing rects as long as that does not upload much more
+	// than uploading them separately would (this also absorbs overlaps)
+	for (int i = 0; i < sdl_damage_count; ) {
+		SDL_Rect u;
+		SDL_UnionRect(&sdl_damage_rects[i], &r, &u);
+		if (u.w * u.h <= sdl_damage_rects[i].w * sdl_damage_rects[i].h + r.w * r.h + MERGE_SLACK) {
+			r = u;
+			sdl_damage_rects[i] = sdl_damage_rects[--sdl_damage_count];
+			i = 0;
+		} else
+			i++;
+	}
+
+	// List full? Grow the rect that needs the smallest extra area instead
+	if (sdl_damage_count == MAX_DAMAGE_RECTS) {
+		int best = 0, best_growth = INT_MAX;
+		for (int i = 0; i < sdl_damage_count; i++) {
+			SDL_Rect u;
+			SDL_UnionRect(&sdl_damage_rects[i], &r, &u);
+			int growth = u.w * u.h - sdl_damage_rects[i].w * sdl_damage_rects[i].h;
+			if (growth < best_growth) {
+				best = i;
+				best_growth = growth;
+			}
+		}
+		SDL_UnionRect(&sdl_damage_rects[best], &r, &r);
+		sdl_damage_rects[best] = sdl_damage_rects[--sdl_damage_count];
+		add_damage_rect(r);
+		return;
+	}
+
+	sdl_damage_rects[sdl_damage_count++] = r;
+}
+
+// Upload one rect of guest_surface to sdl_texture, return number of bytes moved or -1
+static int update_texture_rect(const SDL_Rect &r)
+{
+	const Uint8 *src = (const Uint8 *)guest_surface->pixels + r.y * guest_surface->pitch + r.x * guest_surface->format->BytesPerPixel;
+
+	// Same format: upload straight from guest_surface
+	if (guest_surface->format->format == sdl_texture_format) {
+		if (SDL_UpdateTexture(sdl_texture, &r, src, guest_surface->pitch) != 0)
+			return -1;
+		return r.w * r.h * 4;
+	}
+
+	// Otherwise convert into the locked texture, without an intermediate surface
+	void *pixels;
+	int pitch;
+	if (SDL_LockTexture(sdl_texture, &r, &pixels, &pitch) != 0)
+		return -1;
+	int result = SDL_ConvertPixels(r.w, r.h, guest_surface->format->format, src, guest_surface->pitch, sdl_texture_format, pixels, pitch);
+	SDL_UnlockTexture(sdl_texture);
+	if (result != 0)
+		return -1;
+	return r.w * r.h * 4;
+}
+
 static int present_sdl_video()
 {
-	if (SDL_RectEmpty(&sdl_update_video_rect)) return 0;
+	if (sdl_damage_count == 0) return 0;
 	
 	if (!sdl_renderer || !sdl_texture || !guest_surface) {
 		printf("WARNING: A video mode does not appear to have been set.\n");
@@ -911,42 +950,29 @@ static int present_sdl_video()
 	SDL_SetRenderDrawColor(sdl_renderer, 0, 0, 0, 0);	// Use black
 	SDL_RenderClear(sdl_renderer);						// Clear the display
 	
-	// We're about to work with sdl_update_video_rect, so stop other threads from
+	// We're about to work with sdl_damage_rects, so stop other threads from
 	// modifying it!
-	LOCK_PALETTE;
 	SDL_LockMutex(sdl_update_video_mutex);
-    // Convert from the guest OS' pixel format, to the host OS' texture, if necessary.
-    if (host_surface != guest_surface &&
-		host_surface != NULL &&
-		guest_surface != NULL)
-	{
-		SDL_Rect destRect = sdl_update_video_rect;
-		int result = SDL_BlitSurface(guest_surface, &sdl_update_video_rect, host_surface, &destRect);
-		if (result != 0) {
-			SDL_UnlockMutex(sdl_update_video_mutex);
-			UNLOCK_PALETTE;
-			return -1;
+
+	// Update the host OS' texture, one upload per damaged rect
+	int result = 0;
+	for (int i = 0; i < sdl_damage_count; i++) {
+		int bytes = update_texture_rect(sdl_damage_rects[i]);
+		if (bytes < 0) {
+			result = -1;
+			break;
 		}
+		sdl_present_bytes += bytes;
 	}
-	UNLOCK_PALETTE; // passed potential deadlock, can unlock palette
-	
-    // Update the host OS' texture
-    void * srcPixels = (void *)((uint8_t *)host_surface->pixels +
-        sdl_update_video_rect.y * host_surface->pitch +
-        sdl_update_video_rect.x * host_surface->format->BytesPerPixel);
+	sdl_present_rects += sdl_damage_count;
+	sdl_present_frames++;
 
-    if (SDL_UpdateTexture(sdl_texture, &sdl_update_video_rect, srcPixels, host_surface->pitch) != 0) {
-        SDL_UnlockMutex(sdl_update_video_mutex);
+	// We are done working with pixels in guest_surface.  Reset sdl_damage_rects, then let
+	// other threads modify it, as-needed.
+	sdl_damage_count = 0;
+	SDL_UnlockMutex(sdl_update_video_mutex);
+	if (result != 0)
 		return -1;
-	}
-
-    // We are done working with pixels in host_surface.  Reset sdl_update_video_rect, then let
-    // other threads modify it, as-needed.
-    sdl_update_video_rect.x = 0;
-    sdl_update_video_rect.y = 0;
-    sdl_update_video_rect.w = 0;
-    sdl_update_video_rect.h = 0;
-    SDL_UnlockMutex(sdl_update_video_mutex);
 
     // Copy the texture to the display
     if (SDL_RenderCopy(sdl_renderer, sdl_texture, NULL, NULL) != 0) {
@@ -967,7 +993,7 @@ void update_sdl_video(SDL_Surface *s, int numrects, SDL_Rect *rects)
     
     SDL_LockMutex(sdl_update_video_mutex);
     for (int i = 0; i < numrects; ++i) {
-        SDL_UnionRect(&sdl_update_video_rect, &rects[i], &sdl_update_video_rect);
+        add_damage_rect(rects[i]);
     }
     SDL_UnlockMutex(sdl_update_video_mutex);
 }
@@ -1065,7 +1091,6 @@ void driver_base::init()
 	sdl_palette->colors[1].b = 0;
 	sdl_palette->colors[1].a = 255;
 	//sdl_palette->colors[1] = (SDL_Color){ .r = 0, .g = 0, .b = 0, .a = 255 };
-	SDL_SetSurfacePalette(s, sdl_palette);
 }
 
 void driver_base::adapt_to_video_mode() {
@@ -1081,9 +1106,11 @@ void driver_base::adapt_to_video_mode() {
 	Screen_blitter_init(visualFormat, true, mac_depth_of_video_depth(VIDEO_MODE_DEPTH));
 
 	// Load gray ramp to 8->16/32 expand map
-	if (!IsDirectMode(mode))
+	if (!IsDirectMode(mode)) {
 		for (int i=0; i<256; i++)
 			ExpandMap[i] = SDL_MapRGB(f, i, i, i);
+		Screen_expand_map_changed();
+	}
 
 
 	bool hardware_cursor = false;
@@ -1099,12 +1126,7 @@ void driver_base::adapt_to_video_mode() {
 	if (private_data)
 		private_data->cursorHardware = hardware_cursor;
 #endif
-	SDL_LockMutex(sdl_update_video_mutex);
-	sdl_update_video_rect.x = 0;
-	sdl_update_video_rect.y = 0;
-	sdl_update_video_rect.w = VIDEO_MODE_X;
-	sdl_update_video_rect.h = VIDEO_MODE_Y;
-	SDL_UnlockMutex(sdl_update_video_mutex);
+	update_sdl_video(s, 0, 0, VIDEO_MODE_X, VIDEO_MODE_Y);
 	
 	// Hide cursor
 	SDL_ShowCursor(hardware_cursor);
@@ -1165,14 +1187,12 @@ void driver_base::update_palette(void)
 {
 	const VIDEO_MODE &mode = monitor.get_current_mode();
 
-	if ((int)VIDEO_MODE_DEPTH <= VIDEO_DEPTH_8BIT) {
-		SDL_SetSurfacePalette(s, sdl_palette);
-		SDL_LockMutex(sdl_update_video_mutex);
-		sdl_update_video_rect.x = 0;
-		sdl_update_video_rect.y = 0;
-		sdl_update_video_rect.w = VIDEO_MODE_X;
-		sdl_update_video_rect.h = VIDEO_MODE_Y;
-		SDL_UnlockMutex(sdl_update_video_mutex);
+	// Indexed modes are expanded through ExpandMap, so everything drawn with
+	// the old palette has to be redrawn (set_palette() takes care of VOSF)
+	if ((int)VIDEO_MODE_DEPTH <= VIDEO_DEPTH_8BIT && !use_vosf) {
+		const int len = VIDEO_MODE_ROW_BYTES * VIDEO_MODE_Y;
+		for (int i = 0; i < len; i++)
+			the_buffer_copy[i] = !the_buffer[i];
 	}
 }
 
@@ -1606,6 +1626,12 @@ void SDL_monitor_desc::video_close(void)
 
 void VideoExit(void)
 {
+	// Show statistics
+	printf("%llu frames presented, %.1f rects and %.1f KB uploaded per frame\n",
+		   (unsigned long long)sdl_present_frames,
+		   sdl_present_frames ? (double)sdl_present_rects / sdl_present_frames : 0.0,
+		   sdl_present_frames ? sdl_present_bytes / 1024.0 / sdl_present_frames : 0.0);
+
 	// Close displays
 	vector<monitor_desc *>::iterator i, end = VideoMonitors.end();
 	for (i = VideoMonitors.begin(); i != end; ++i)
@@ -1836,6 +1862,7 @@ void SDL_monitor_desc::set_palette(uint8 *pal, int num_in)
 			int c = i & (num_in-1); // If there are less than 256 colors, we repeat the first entries (this makes color expansion easier)
 			ExpandMap[i] = SDL_MapRGB(drv->s->format, pal[c*3+0], pal[c*3+1], pal[c*3+2]);
 		}
+		Screen_expand_map_changed();
 
 #ifdef ENABLE_VOSF
 		if (use_vosf) {
@@ -2429,220 +2456,92 @@ static void handle_events(void)
  */
 
 // Static display update (fixed frame rate, but incremental)
+// The frame buffer is compared against the_buffer_copy in tiles of
+// TILE_W x TILE_H pixels. Horizontal runs of dirty tiles are blitted and
+// merged with the run directly above them if it spans the same columns.
 static void update_display_static(driver_base *drv)
 {
-	// Incremental update code
-	int wide = 0, high = 0;
-	uint32 x1, x2, y1, y2;
 	const VIDEO_MODE &mode = drv->mode;
-	int bytes_per_row = VIDEO_MODE_ROW_BYTES;
-	uint8 *p, *p2;
-	uint32 x2_clipped, wide_clipped;
-
-	// Check for first line from top and first line from bottom that have changed
-	y1 = 0;
-	for (uint32 j = 0; j < VIDEO_MODE_Y; j++) {
-		if (memcmp(&the_buffer[j * bytes_per_row], &the_buffer_copy[j * bytes_per_row], bytes_per_row)) {
-			y1 = j;
-			break;
-		}
-	}
-	y2 = y1 - 1;
-	for (uint32 j = VIDEO_MODE_Y; j-- > y1; ) {
-		if (memcmp(&the_buffer[j * bytes_per_row], &the_buffer_copy[j * bytes_per_row], bytes_per_row)) {
-			y2 = j;
-			break;
-		}
-	}
-	high = y2 - y1 + 1;
-
-	// Check for first column from left and first column from right that have changed
-	if (high) {
-		if ((int)VIDEO_MODE_DEPTH < (int)VIDEO_DEPTH_8BIT) {
-			const int src_bytes_per_row = bytes_per_row;
-			const int dst_bytes_per_row = drv->s->pitch;
-			const int pixels_per_byte = 8/mac_depth_of_video_depth(VIDEO_MODE_DEPTH);
-
-			const uint32 line_len = TrivialBytesPerRow(VIDEO_MODE_X, VIDEO_MODE_DEPTH);
-			
-			x1 = line_len;
-			for (uint32 j = y1; j <= y2; j++) {
-				p = &the_buffer[j * bytes_per_row];
-				p2 = &the_buffer_copy[j * bytes_per_row];
-				for (uint32 i = 0; i < x1; i++) {
-					if (*p != *p2) {
-						x1 = i;
-						break;
-					}
-					p++; p2++;
-				}
-			}
-			x2 = x1;
-			for (uint32 j = y1; j <= y2; j++) {
-				p = &the_buffer[j * bytes_per_row];
-				p2 = &the_buffer_copy[j * bytes_per_row];
-				p += bytes_per_row;
-				p2 += bytes_per_row;
-				for (uint32 i = line_len; i > x2; i--) {
-					p--; p2--;
-					if (*p != *p2) {
-						x2 = i;
-						break;
-					}
-				}
-			}
-
-			x1 *= pixels_per_byte;
-			x2 *= pixels_per_byte;
-			wide = x2 - x1;
-			x2_clipped = x2 > VIDEO_MODE_X? VIDEO_MODE_X : x2;
-			wide_clipped = x2_clipped - x1;
-
-			// Update copy of the_buffer
-			if (high && wide) {
-
-				// Lock surface, if required
-				if (SDL_MUSTLOCK(drv->s))
-					SDL_LockSurface(drv->s);
-
-				// Blit to screen surface
-				int si = y1 * src_bytes_per_row + (x1 / pixels_per_byte);
-				int di = y1 * dst_bytes_per_row + x1;
-				for (uint32 j = y1; j <= y2; j++) {
-					memcpy(the_buffer_copy + si, the_buffer + si, wide / pixels_per_byte);
-					Screen_blit((uint8 *)drv->s->pixels + di, the_buffer + si, wide / pixels_per_byte);
-					si += src_bytes_per_row;
-					di += dst_bytes_per_row;
-				}
-
-				// Unlock surface, if required
-				if (SDL_MUSTLOCK(drv->s))
-					SDL_UnlockSurface(drv->s);
+	const uint32 TILE_W = 64;	// Multiple of 8 so that tiles start on a byte boundary at 1 bit/pixel
+	const uint32 TILE_H = 16;
 
-				// Refresh display
-				update_sdl_video(drv->s, x1, y1, wide_clipped, high);
+	const uint32 src_bits_per_pixel = mac_depth_of_video_depth(VIDEO_MODE_DEPTH);
+	const uint32 dst_bytes_per_pixel = drv->s->format->BytesPerPixel;
+	const uint32 src_bytes_per_row = VIDEO_MODE_ROW_BYTES;
+	const uint32 dst_bytes_per_row = drv->s->pitch;
+	const uint32 n_x_tiles = (VIDEO_MODE_X + TILE_W - 1) / TILE_W;
+
+	static vector<SDL_Rect> rects;
+	static vector<int> prev_band, cur_band;	// Rects ending on the previous/current band, by starting tile column
+	rects.clear();
+	prev_band.assign(n_x_tiles, -1);
+	cur_band.resize(n_x_tiles);
+
+	bool locked = false;
+	for (uint32 y = 0; y < VIDEO_MODE_Y; y += TILE_H) {
+		const uint32 h = std::min(TILE_H, (uint32)VIDEO_MODE_Y - y);
+		const uint32 row_offset = y * src_bytes_per_row;
+		std::fill(cur_band.begin(), cur_band.end(), -1);
+
+		uint32 tx = 0;
+		while (tx < n_x_tiles) {
+
+			// Find next run of dirty tiles in this band
+			const uint32 first = tx;
+			uint32 last = tx;
+			while (last < n_x_tiles) {
+				const uint32 x = last * TILE_W;
+				const uint32 w = std::min(TILE_W, (uint32)VIDEO_MODE_X - x);
+				const uint32 offset = row_offset + x * src_bits_per_pixel / 8;
+				if (!Screen_tile_differs(the_buffer + offset, the_buffer_copy + offset, (w * src_bits_per_pixel + 7) / 8, h, src_bytes_per_row))
+					break;
+				last++;
 			}
-
-		} else {
-			const int bytes_per_pixel = VIDEO_MODE_ROW_BYTES / VIDEO_MODE_X;
-			const int dst_bytes_per_row = drv->s->pitch;
-
-			x1 = VIDEO_MODE_X;
-			for (uint32 j = y1; j <= y2; j++) {
-				p = &the_buffer[j * bytes_per_row];
-				p2 = &the_buffer_copy[j * bytes_per_row];
-				for (uint32 i = 0; i < x1 * bytes_per_pixel; i++) {
-					if (*p != *p2) {
-						x1 = i / bytes_per_pixel;
-						break;
-					}
-					p++; p2++;
-				}
+			if (last == first) {
+				tx++;
+				continue;
 			}
-			x2 = x1;
-			for (uint32 j = y1; j <= y2; j++) {
-				p = &the_buffer[j * bytes_per_row];
-				p2 = &the_buffer_copy[j * bytes_per_row];
-				p += bytes_per_row;
-				p2 += bytes_per_row;
-				for (uint32 i = VIDEO_MODE_X * bytes_per_pixel; i > x2 * bytes_per_pixel; i--) {
-					p--;
-					p2--;
-					if (*p != *p2) {
-						x2 = i / bytes_per_pixel;
-						break;
-					}
-				}
+			tx = last;
+
+			// Copy the run and blit it to the screen surface
+			const uint32 x = first * TILE_W;
+			const uint32 w = std::min(last * TILE_W, (uint32)VIDEO_MODE_X) - x;
+			const uint32 length = (w * src_bits_per_pixel + 7) / 8;
+			if (!locked && SDL_MUSTLOCK(drv->s)) {
+				SDL_LockSurface(drv->s);
+				locked = true;
 			}
-			wide = x2 - x1;
-
-			// Update copy of the_buffer
-			if (high && wide) {
-
-				// Lock surface, if required
-				if (SDL_MUSTLOCK(drv->s))
-					SDL_LockSurface(drv->s);
-
-				// Blit to screen surface
-				for (uint32 j = y1; j <= y2; j++) {
-					uint32 i = j * bytes_per_row + x1 * bytes_per_pixel;
-					int dst_i = j * dst_bytes_per_row + x1 * bytes_per_pixel;
-					memcpy(the_buffer_copy + i, the_buffer + i, bytes_per_pixel * wide);
-					Screen_blit((uint8 *)drv->s->pixels + dst_i, the_buffer + i, bytes_per_pixel * wide);
-				}
-
-				// Unlock surface, if required
-				if (SDL_MUSTLOCK(drv->s))
-					SDL_UnlockSurface(drv->s);
-
-				// Refresh display
-				update_sdl_video(drv->s, x1, y1, wide, high);
+			uint32 si = row_offset + x * src_bits_per_pixel / 8;
+			uint32 di = y * dst_bytes_per_row + x * dst_bytes_per_pixel;
+			for (uint32 j = 0; j < h; j++) {
+				memcpy(the_buffer_copy + si, the_buffer + si, length);
+				Screen_blit((uint8 *)drv->s->pixels + di, the_buffer + si, length);
+				si += src_bytes_per_row;
+				di += dst_bytes_per_row;
 			}
-		}
-	}
-}
-
-// Static display update (fixed frame rate, bounding boxes based)
-// XXX use NQD bounding boxes to help detect dirty areas?
-static void update_display_static_bbox(driver_base *drv)
-{
-	const VIDEO_MODE &mode = drv->mode;
-
-	// Allocate bounding boxes for SDL_UpdateRects()
-	const uint32 N_PIXELS = 64;
-	const uint32 n_x_boxes = (VIDEO_MODE_X + N_PIXELS - 1) / N_PIXELS;
-	const uint32 n_y_boxes = (VIDEO_MODE_Y + N_PIXELS - 1) / N_PIXELS;
-	SDL_Rect *boxes = (SDL_Rect *)_alloca(sizeof(SDL_Rect) * n_x_boxes * n_y_boxes);
-	uint32 nr_boxes = 0;
-
-	// Lock surface, if required
-	if (SDL_MUSTLOCK(drv->s))
-		SDL_LockSurface(drv->s);
 
-	// Update the surface from Mac screen
-	const uint32 bytes_per_row = VIDEO_MODE_ROW_BYTES;
-	const uint32 bytes_per_pixel = bytes_per_row / VIDEO_MODE_X;
-	const uint32 dst_bytes_per_row = drv->s->pitch;
-	for (uint32 y = 0; y < VIDEO_MODE_Y; y += N_PIXELS) {
-		uint32 h = N_PIXELS;
-		if (h > VIDEO_MODE_Y - y)
-			h = VIDEO_MODE_Y - y;
-		for (uint32 x = 0; x < VIDEO_MODE_X; x += N_PIXELS) {
-			uint32 w = N_PIXELS;
-			if (w > VIDEO_MODE_X - x)
-				w = VIDEO_MODE_X - x;
-			const int xs = w * bytes_per_pixel;
-			const int xb = x * bytes_per_pixel;
-			bool dirty = false;
-			for (uint32 j = y; j < (y + h); j++) {
-				const uint32 yb = j * bytes_per_row;
-				const uint32 dst_yb = j * dst_bytes_per_row;
-				if (memcmp(&the_buffer[yb + xb], &the_buffer_copy[yb + xb], xs) != 0) {
-					memcpy(&the_buffer_copy[yb + xb], &the_buffer[yb + xb], xs);
-					Screen_blit((uint8 *)drv->s->pixels + dst_yb + xb, the_buffer + yb + xb, xs);
-					dirty = true;
-				}
-			}
-			if (dirty) {
-				boxes[nr_boxes].x = x;
-				boxes[nr_boxes].y = y;
-				boxes[nr_boxes].w = w;
-				boxes[nr_boxes].h = h;
-				nr_boxes++;
+			// Extend the rect above if it covers the same columns, otherwise start a new one
+			int r = prev_band[first];
+			if (r >= 0 && rects[r].w == (int)w)
+				rects[r].h += h;
+			else {
+				SDL_Rect rect = { (int)x, (int)y, (int)w, (int)h };
+				r = rects.size();
+				rects.push_back(rect);
 			}
+			cur_band[first] = r;
 		}
+		prev_band.swap(cur_band);
 	}
 
-	// Unlock surface, if required
-	if (SDL_MUSTLOCK(drv->s))
+	if (locked)
 		SDL_UnlockSurface(drv->s);
 
 	// Refresh display
-	if (nr_boxes)
-		update_sdl_video(drv->s, nr_boxes, boxes);
+	if (!rects.empty())
+		update_sdl_video(drv->s, rects.size(), &rects[0]);
 }
 
-
 // We suggest the compiler to inline the next two functions so that it
 // may specialise the code according to the current screen depth and
 // display type. A clever compiler would do that job by itself though...
@@ -2703,7 +2602,7 @@ static void video_refresh_dga_vosf(void)
 	static uint32 tick_counter = 0;
 	if (++tick_counter >= frame_skip) {
 		tick_counter = 0;
-		if (mainBuffer.dirty) {
+		if (vosf_check_dirty()) {
 			LOCK_VOSF;
 			update_display_dga_vosf(drv);
 			UNLOCK_VOSF;
@@ -2721,7 +2620,7 @@ static void video_refresh_window_vosf(void)
 	static uint32 tick_counter = 0;
 	if (++tick_counter >= frame_skip) {
 		tick_counter = 0;
-		if (mainBuffer.dirty) {
+		if (vosf_check_dirty()) {
 			LOCK_VOSF;
 			update_display_window_vosf(drv);
 			UNLOCK_VOSF;
@@ -2739,11 +2638,7 @@ static void video_refresh_window_static(void)
 	static uint32 tick_counter = 0;
 	if (++tick_counter >= frame_skip) {
 		tick_counter = 0;
-		const VIDEO_MODE &mode = drv->mode;
-		if ((int)VIDEO_MODE_DEPTH >= VIDEO_DEPTH_8BIT)
-			update_display_static_bbox(drv);
-		else
-			update_display_static(drv);
+		update_display_static(drv);
 	}
 }
 
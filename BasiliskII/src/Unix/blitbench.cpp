@@ -0,0 +1,251 @@
+/*
+ *  blitbench.cpp - Frame buffer blitter validation and benchmark
+ *
+ *  Basilisk II (C) 1997-2008 Christian Bauer
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ *  Checks the vector versions of the blitters in video_blit.cpp against
+ *  the scalar ones, and measures them. Usage:
+ *
+ *    blitbench [width height]
+ *
+ *  For each host pixel format and byte order that needs conversion, the
+ *  version Screen_blitter_init() picks at each instruction set this CPU
+ *  supports is validated on random lines of random length and alignment,
+ *  then timed on full frames (1920x1080 by default). A blitter whose
+ *  vector version loses to a narrower one shows fewer lines; lower its
+ *  entry in Screen_blit_simd_table to measure the others. The table driven expansion of 1/2/4/8-bit indexed modes
+ *  to 8/16/32-bit hosts is checked the same way, against a pixel by pixel
+ *  expansion through a random ExpandMap. The exit status is nonzero if any
+ *  blitter is wrong.
+ */
+
+#include "sysdeps.h"
+
+#include <time.h>
+
+#include "video.h"
+#include "video_blit.h"
+
+// Host pixel formats to test
+struct blit_format {
+	const char *name;
+	int depth;				// Host depth
+	uint32 Rmask, Gmask, Bmask;
+	int mac_depth;			// Guest depth
+};
+
+static const blit_format formats[] = {
+	{ "RGB555", 15, 0x007c00, 0x0003e0, 0x00001f, 16 },
+	{ "BGR555", 15, 0x00001f, 0x0003e0, 0x007c00, 16 },
+	{ "RGB565", 16, 0x00f800, 0x0007e0, 0x00001f, 16 },
+	{ "RGB888", 32, 0xff0000, 0x00ff00, 0x0000ff, 32 },
+	{ "BGR888", 32, 0x0000ff, 0x00ff00, 0xff0000, 32 },
+};
+
+// Host pixel formats for indexed modes
+static const blit_format expand_formats[] = {
+	{ "8-bit",  8,  0x000000, 0x000000, 0x000000, 0 },
+	{ "RGB565", 16, 0x00f800, 0x0007e0, 0x00001f, 0 },
+	{ "RGB888", 32, 0xff0000, 0x00ff00, 0x0000ff, 0 },
+};
+
+static const char *simd_names[] = { "scalar", "SSE2", "SSSE3", "AVX2" };
+
+static const int GUARD = 64;	// Bytes checked for overruns after each line
+
+static uint64 host_usec(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64)t.tv_sec * 1000000 + t.tv_nsec / 1000;
+}
+
+// Select the blitter for a format with the given instruction set
+static void (*select_blitter(blit_format const & f, bool native_byte_order, int level))(uint8 *, const uint8 *, uint32)
+{
+	VisualFormat visual_format;
+	visual_format.fullscreen = true;	// Windowed 1-bit mode doesn't need a blitter
+	visual_format.depth = f.depth;
+	visual_format.Rmask = f.Rmask;
+	visual_format.Gmask = f.Gmask;
+	visual_format.Bmask = f.Bmask;
+	Screen_simd_level = level;
+	if (!Screen_blitter_init(visual_format, native_byte_order, f.mac_depth))
+		return NULL;	// Plain copy
+	return Screen_blit;
+}
+
+// Compare a blitter against the reference one on random lines, EXPANSION
+// being the number of output bytes per source byte
+static bool validate(void (*ref)(uint8 *, const uint8 *, uint32), void (*blit)(uint8 *, const uint8 *, uint32), int bytes_per_pixel, int expansion)
+{
+	const int MAX_LENGTH = 4096;
+	static uint8 src[MAX_LENGTH + 64], dst_ref[MAX_LENGTH + 64 + GUARD], dst[MAX_LENGTH + 64 + GUARD];
+	for (int i = 0; i < 20000; i++) {
+		const uint32 length = (rand() % (MAX_LENGTH / expansion / bytes_per_pixel + 1)) * bytes_per_pixel;
+		const uint32 src_ofs = (rand() % 32) * bytes_per_pixel;
+		const uint32 dst_ofs = (rand() % 32) * bytes_per_pixel;
+		for (uint32 j = 0; j < sizeof(src); j++)
+			src[j] = rand();
+		memset(dst_ref, 0x5a, sizeof(dst_ref));
+		memset(dst, 0x5a, sizeof(dst));
+		ref(dst_ref + dst_ofs, src + src_ofs, length);
+		blit(dst + dst_ofs, src + src_ofs, length);
+		if (memcmp(dst_ref, dst, sizeof(dst)) != 0) {
+			uint32 k = 0;
+			while (dst_ref[k] == dst[k])
+				k++;
+			printf("  MISMATCH at byte %u of %u (source offset %u, dest offset %u)\n",
+				   k - dst_ofs, length, src_ofs, dst_ofs);
+			return false;
+		}
+	}
+	return true;
+}
+
+// Expand indexed pixels one at a time, as reference
+static int ref_mac_depth, ref_host_bytes;
+
+static void expand_reference(uint8 * dest, const uint8 * source, uint32 length)
+{
+	const int pixels_per_byte = 8 / ref_mac_depth;
+	const uint32 index_mask = (1 << ref_mac_depth) - 1;
+	for (uint32 i = 0; i < length; i++) {
+		for (int k = 0; k < pixels_per_byte; k++) {
+			const uint32 index = (source[i] >> (8 - ref_mac_depth * (k + 1))) & index_mask;
+			if (ref_host_bytes == 1)
+				*dest = index;
+			else if (ref_host_bytes == 2) {
+				const uint16 pixel = ExpandMap[index];
+				memcpy(dest, &pixel, 2);
+			} else
+				memcpy(dest, &ExpandMap[index], 4);
+			dest += ref_host_bytes;
+		}
+	}
+}
+
+// Return the time of a full frame blit, in milliseconds
+static double benchmark(void (*blit)(uint8 *, const uint8 *, uint32), uint8 *dst, const uint8 *src, uint32 bytes_per_row, int height)
+{
+	int frames = 0;
+	uint64 start = host_usec(), elapsed;
+	do {
+		for (int y = 0; y < height; y++)
+			blit(dst + y * bytes_per_row, src + y * bytes_per_row, bytes_per_row);
+		frames++;
+		elapsed = host_usec() - start;
+	} while (elapsed < 200000);
+	return elapsed / 1000.0 / frames;
+}
+
+int main(int argc, char **argv)
+{
+	int width = 1920, height = 1080;
+	if (argc == 3) {
+		width = atoi(argv[1]);
+		height = atoi(argv[2]);
+	}
+	if (width <= 0 || height <= 0) {
+		fprintf(stderr, "usage: %s [width height]\n", argv[0]);
+		return 2;
+	}
+
+	const int cpu_level = Screen_simd_level;
+	printf("CPU supports %s\n", simd_names[cpu_level]);
+
+	uint8 *src = (uint8 *)malloc(width * height * 4);
+	uint8 *dst = (uint8 *)malloc(width * height * 4);
+	if (!src || !dst) {
+		fprintf(stderr, "cannot allocate frame buffers\n");
+		return 1;
+	}
+	for (int i = 0; i < width * height * 4; i++)
+		src[i] = rand();
+
+	bool ok = true;
+	const int formats_count = sizeof(formats) / sizeof(formats[0]);
+	for (int i = 0; i < formats_count; i++) {
+		for (int nbo = 1; nbo >= 0; nbo--) {
+			blit_format const & f = formats[i];
+			void (*ref)(uint8 *, const uint8 *, uint32) = select_blitter(f, nbo, SCREEN_SIMD_NONE);
+			if (ref == NULL)
+				continue;
+			const int bytes_per_pixel = f.mac_depth / 8;
+			const uint32 bytes_per_row = width * bytes_per_pixel;
+			printf("%s %s:\n", f.name, nbo ? "NBO" : "OBO");
+
+			const double ref_ms = benchmark(ref, dst, src, bytes_per_row, height);
+			printf("  %-6s %8.3f ms/frame\n", simd_names[SCREEN_SIMD_NONE], ref_ms);
+			void (*prev)(uint8 *, const uint8 *, uint32) = ref;
+			for (int level = SCREEN_SIMD_SSE2; level <= cpu_level; level++) {
+				void (*blit)(uint8 *, const uint8 *, uint32) = select_blitter(f, nbo, level);
+				if (blit == prev)
+					continue;	// Nothing new at this level
+				prev = blit;
+				if (!validate(ref, blit, bytes_per_pixel, 1)) {
+					printf("  %-6s FAILED\n", simd_names[level]);
+					ok = false;
+					continue;
+				}
+				const double ms = benchmark(blit, dst, src, bytes_per_row, height);
+				printf("  %-6s %8.3f ms/frame (%.1fx)\n", simd_names[level], ms, ref_ms / ms);
+			}
+		}
+	}
+
+	const int expand_formats_count = sizeof(expand_formats) / sizeof(expand_formats[0]);
+	for (int i = 0; i < expand_formats_count; i++) {
+		for (int mac_depth = 1; mac_depth <= 8; mac_depth *= 2) {
+			blit_format f = expand_formats[i];
+			if (mac_depth >= f.depth)
+				continue;
+			f.mac_depth = mac_depth;
+			ref_mac_depth = mac_depth;
+			ref_host_bytes = f.depth / 8;
+			for (int j = 0; j < 256; j++)
+				ExpandMap[j] = (rand() << 16) ^ rand();
+			printf("%d-bit on %s:\n", mac_depth, f.name);
+
+			// Frame of source bytes, expanded to width pixels
+			const uint32 bytes_per_row = width * mac_depth / 8;
+			const double ref_ms = benchmark(expand_reference, dst, src, bytes_per_row, height);
+			printf("  %-6s %8.3f ms/frame\n", "pixel", ref_ms);
+			void (*prev)(uint8 *, const uint8 *, uint32) = NULL;
+			for (int level = SCREEN_SIMD_NONE; level <= cpu_level; level++) {
+				void (*blit)(uint8 *, const uint8 *, uint32) = select_blitter(f, true, level);
+				Screen_expand_map_changed();
+				if (blit == prev)
+					continue;
+				prev = blit;
+				if (!validate(expand_reference, blit, 1, ref_host_bytes * 8 / mac_depth)) {
+					printf("  %-6s FAILED\n", simd_names[level]);
+					ok = false;
+					continue;
+				}
+				const double ms = benchmark(blit, dst, src, bytes_per_row, height);
+				printf("  %-6s %8.3f ms/frame (%.1fx)\n", simd_names[level], ms, ref_ms / ms);
+			}
+		}
+	}
+
+	free(src);
+	free(dst);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,727 @@
+/*
+ *  cpubench.cpp - 68k emulation core benchmark
+ *
+ *  Basilisk II (C) 1997-2008 Christian Bauer
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+/*
+ *  Runs small 68k kernels on the CPU core alone, without a ROM or any of
+ *  the Mac hardware emulation. Usage:
+ *
+ *    cpubench [name=value ...] [kernel|file ...]
+ *
+ *  name=value pairs override the prefs seen by the CPU core (jit, jitfpu,
+ *  jitcachesize, predecode, ...) plus "cpu", "fpu", "scale", which
+ *  multiplies the iteration counts of the built-in kernels, and "irqrate".
+ *  With irqrate=n, a host thread raises a level 1 interrupt n times per
+ *  second while a kernel runs, and the delivery latency is reported;
+ *  comparing the MIPS to a run without interrupts gives the overhead of
+ *  interrupt handling in the CPU thread. Without any
+ *  kernel arguments, all built-in kernels are run. Any other argument is
+ *  loaded as raw 68k code at CODE_ADDR; it runs in supervisor mode until
+ *  it executes M68K_EXEC_RETURN, and may report a result in D0 with
+ *  M68K_EMUL_BREAK just before.
+ */
+
+#include "sysdeps.h"
+
+#include <time.h>
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "cpu_emulation.h"
+#include "main.h"
+#include "prefs.h"
+#include "emul_op.h"
+#include "timer.h"
+#include "vm_alloc.h"
+#include "sigsegv.h"
+#include "compiler/compemu.h"
+
+// From newcpu.cpp
+extern bool quit_program;
+
+#if USE_JIT
+extern bool compiler_write_fault(void *fault_address); // from compemu_support.cpp
+#endif
+
+// Globals otherwise defined by main_*.cpp
+int CPUType;
+int FPUType;
+uint32 InterruptFlags = 0;
+
+void SetInterruptFlag(uint32 flag)
+{
+	__atomic_fetch_or(&InterruptFlags, flag, __ATOMIC_RELEASE);
+}
+
+void ClearInterruptFlag(uint32 flag)
+{
+	__atomic_fetch_and(&InterruptFlags, ~flag, __ATOMIC_RELAXED);
+}
+
+#ifdef USE_CPU_EMUL_TICKS
+// No periodic tasks, just keep the instruction countdown away from zero
+int32 emulated_ticks = 0x7fffffff;
+
+void cpu_do_check_ticks(void)
+{
+	emulated_ticks = 0x7fffffff;
+}
+#endif
+
+void idle_wait(void)
+{
+}
+
+void idle_resume(void)
+{
+}
+
+
+/*
+ *  Prefs: built-in defaults, overridden from the command line
+ */
+
+static const char *default_prefs[][2] = {
+	{"jit", "true"},
+	{"jitfpu", "true"},
+	{"jitcachesize", "8192"},
+	{"jitlazyflush", "true"},
+	{"jitinline", "true"},
+	{"cpu", "4"},
+	{"fpu", "true"},
+	{"ramsize", "8"},
+	{"scale", "1"},
+	{"irqrate", "0"},
+};
+
+const int MAX_PREF_ARGS = 64;
+static const char *pref_args[MAX_PREF_ARGS][2];
+static int num_pref_args = 0;
+
+static const char *find_pref(const char *name)
+{
+	for (int i = num_pref_args - 1; i >= 0; i--)
+		if (strcmp(pref_args[i][0], name) == 0)
+			return pref_args[i][1];
+	for (size_t i = 0; i < sizeof(default_prefs) / sizeof(default_prefs[0]); i++)
+		if (strcmp(default_prefs[i][0], name) == 0)
+			return default_prefs[i][1];
+	return NULL;
+}
+
+const char *PrefsFindString(const char *name, int index)
+{
+	return index == 0 ? find_pref(name) : NULL;
+}
+
+bool PrefsFindBool(const char *name)
+{
+	const char *v = find_pref(name);
+	return v && (strcmp(v, "true") == 0 || strcmp(v, "on") == 0 || strcmp(v, "1") == 0);
+}
+
+int32 PrefsFindInt32(const char *name)
+{
+	const char *v = find_pref(name);
+	return v ? atoi(v) : 0;
+}
+
+
+/*
+ *  Memory layout (Mac addresses)
+ */
+
+const uint32 VECTOR_STUB = 0x1000;		// All exception vectors point here
+const uint32 IRQ_STUB = 0x1010;			// Level 1 interrupt handler
+const uint32 STACK_TOP = 0x8000;
+const uint32 CODE_ADDR = 0x10000;		// Kernels are loaded here
+const uint32 SRC_ADDR = 0x100000;		// Data buffers for the memcpy kernel
+const uint32 DST_ADDR = 0x200000;
+const uint32 COPY_SIZE = 0x10000;
+
+static const uint16 vector_stub[] = {
+	M68K_EMUL_OP_SHUTDOWN,				// Flags the run as faulted
+	M68K_EXEC_RETURN
+};
+
+static const uint16 irq_stub[] = {
+	M68K_EMUL_OP_IRQ,
+	0x4e73								// rte
+};
+
+static const uint16 reset_code[] = {	// At ROMBaseMac + 0x2a
+	0x2e7c, 0x0000, 0x8000,				// movea.l	#STACK_TOP,a7
+	0x203c, 0x8000, 0x8001,				// move.l	#$80008001,d0
+	0x4e7b, 0x0002,						// movec	d0,cacr
+	0x46fc, 0x2000,						// move		#$2000,sr
+	0x4ef9, 0x0001, 0x0000				// jmp		CODE_ADDR
+};
+
+
+/*
+ *  Built-in kernels, hand-assembled. Each one starts with a
+ *  "move.l #n,d1" that the iteration count is patched into, and
+ *  finishes with M68K_EMUL_BREAK to report D0, then M68K_EXEC_RETURN.
+ */
+
+static const uint16 intloop_code[] = {
+	0x223c, 0x0000, 0x0000,				// move.l	#n,d1
+	0x7000,								// moveq	#0,d0
+	0x7401,								// moveq	#1,d2
+	0xd082,								// 1$:	add.l	d2,d0
+	0xb380,								// eor.l	d1,d0
+	0x5682,								// addq.l	#3,d2
+	0x5381,								// subq.l	#1,d1
+	0x66f6,								// bne.s	1$
+	M68K_EMUL_BREAK, M68K_EXEC_RETURN
+};
+
+static uint64 intloop_insns(uint32 n) { return 3 + 5 * uint64(n) + 2; }
+
+static uint32 intloop_result(uint32 n)
+{
+	uint32 d0 = 0, d2 = 1;
+	for (uint32 d1 = n; d1; d1--) {
+		d0 += d2;
+		d0 ^= d1;
+		d2 += 3;
+	}
+	return d0;
+}
+
+static const uint16 memcpy_code[] = {
+	0x223c, 0x0000, 0x0000,				// move.l	#n,d1
+	0x41f9, 0x0010, 0x0000,				// 1$:	lea	SRC_ADDR,a0
+	0x43f9, 0x0020, 0x0000,				// lea		DST_ADDR,a1
+	0x343c, COPY_SIZE / 4 - 1,			// move.w	#COPY_SIZE/4-1,d2
+	0x22d8,								// 2$:	move.l	(a0)+,(a1)+
+	0x51ca, 0xfffc,						// dbra		d2,2$
+	0x5381,								// subq.l	#1,d1
+	0x66e6,								// bne.s	1$
+	0x43f9, 0x0020, 0x0000,				// lea		DST_ADDR,a1
+	0x343c, COPY_SIZE / 4 - 1,			// move.w	#COPY_SIZE/4-1,d2
+	0x7000,								// moveq	#0,d0
+	0xd099,								// 3$:	add.l	(a1)+,d0
+	0x51ca, 0xfffc,						// dbra		d2,3$
+	M68K_EMUL_BREAK, M68K_EXEC_RETURN
+};
+
+static void memcpy_setup(void)
+{
+	for (uint32 i = 0; i < COPY_SIZE; i += 4)
+		WriteMacInt32(SRC_ADDR + i, i * 0x9e3779b9);
+	Mac_memset(DST_ADDR, 0, COPY_SIZE);
+}
+
+static uint64 memcpy_insns(uint32 n)
+{
+	const uint64 longs = COPY_SIZE / 4;
+	return 1 + n * (3 + 2 * longs + 2) + 3 + 2 * longs + 2;
+}
+
+static uint32 memcpy_result(uint32 n)
+{
+	uint32 sum = 0;
+	for (uint32 i = 0; i < COPY_SIZE; i += 4)
+		sum += i * 0x9e3779b9;
+	return sum;
+}
+
+static const uint16 fpu_code[] = {
+	0x223c, 0x0000, 0x0000,				// move.l	#n,d1
+	0xf23c, 0x4000, 0x0000, 0x0000,		// fmove.l	#0,fp0
+	0xf201, 0x4080,						// 1$:	fmove.l	d1,fp1
+	0xf200, 0x0504,						// fsqrt.x	fp1,fp2
+	0xf200, 0x0822,						// fadd.x	fp2,fp0
+	0x5381,								// subq.l	#1,d1
+	0x66f0,								// bne.s	1$
+	0xf23c, 0x4020, 0x0000, 0x0400,		// fdiv.l	#1024,fp0
+	0xf200, 0x6000,						// fmove.l	fp0,d0
+	M68K_EMUL_BREAK, M68K_EXEC_RETURN
+};
+
+static uint64 fpu_insns(uint32 n) { return 2 + 5 * uint64(n) + 2 + 2; }
+
+static uint32 fpu_result(uint32 n)
+{
+	double sum = 0;
+	for (uint32 d1 = n; d1; d1--)
+		sum += sqrt(double(d1));
+	return uint32(int32(lrint(sum / 1024)));
+}
+
+static const uint16 movem_code[] = {
+	0x223c, 0x0000, 0x0000,				// move.l	#n,d1
+	0x7000,								// moveq	#0,d0
+	0x48e7, 0x3f3e,						// 1$:	movem.l	d2-d7/a2-a6,-(a7)
+	0xd081,								// add.l	d1,d0
+	0x4cdf, 0x7cfc,						// movem.l	(a7)+,d2-d7/a2-a6
+	0x5381,								// subq.l	#1,d1
+	0x66f2,								// bne.s	1$
+	M68K_EMUL_BREAK, M68K_EXEC_RETURN
+};
+
+// Same as fpu, with the FPU set to double precision
+static const uint16 fpudbl_code[] = {
+	0x223c, 0x0000, 0x0000,				// move.l	#n,d1
+	0xf23c, 0x9000, 0x0000, 0x0080,		// fmove.l	#$80,fpcr
+	0xf23c, 0x4000, 0x0000, 0x0000,		// fmove.l	#0,fp0
+	0xf201, 0x4080,						// 1$:	fmove.l	d1,fp1
+	0xf200, 0x0504,						// fsqrt.x	fp1,fp2
+	0xf200, 0x0822,						// fadd.x	fp2,fp0
+	0x5381,								// subq.l	#1,d1
+	0x66f0,								// bne.s	1$
+	0xf23c, 0x4020, 0x0000, 0x0400,		// fdiv.l	#1024,fp0
+	0xf200, 0x6000,						// fmove.l	fp0,d0
+	0xf23c, 0x9000, 0x0000, 0x0000,		// fmove.l	#0,fpcr
+	M68K_EMUL_BREAK, M68K_EXEC_RETURN
+};
+
+static uint64 fpudbl_insns(uint32 n) { return 3 + 5 * uint64(n) + 3 + 2; }
+
+// Same as fpu, with the FPU set to single precision. The result is the
+// one the interpreter gets, so that translated code can be checked
+// against it
+static const uint16 fpusgl_code[] = {
+	0x223c, 0x0000, 0x0000,				// move.l	#n,d1
+	0xf23c, 0x9000, 0x0000, 0x0040,		// fmove.l	#$40,fpcr
+	0xf23c, 0x4000, 0x0000, 0x0000,		// fmove.l	#0,fp0
+	0xf201, 0x4080,						// 1$:	fmove.l	d1,fp1
+	0xf200, 0x0504,						// fsqrt.x	fp1,fp2
+	0xf200, 0x0822,						// fadd.x	fp2,fp0
+	0x5381,								// subq.l	#1,d1
+	0x66f0,								// bne.s	1$
+	0xf23c, 0x4020, 0x0000, 0x0400,		// fdiv.l	#1024,fp0
+	0xf200, 0x6000,						// fmove.l	fp0,d0
+	0xf23c, 0x9000, 0x0000, 0x0000,		// fmove.l	#0,fpcr
+	M68K_EMUL_BREAK, M68K_EXEC_RETURN
+};
+
+static uint64 movem_insns(uint32 n) { return 2 + 5 * uint64(n) + 2; }
+
+static uint32 movem_result(uint32 n)
+{
+	return uint32(uint64(n) * (n + 1) / 2);
+}
+
+// Calls a subroutine through JSR (An) and BSR, and gets back to the
+// loop through JMP (An)
+static const uint16 call_code[] = {
+	0x223c, 0x0000, 0x0000,				// move.l	#n,d1
+	0x7000,								// moveq	#0,d0
+	0x41fa, 0x000c,						// lea		3$(pc),a0
+	0x43fa, 0x000e,						// lea		2$(pc),a1
+	0x4e90,								// 1$:	jsr	(a0)
+	0x6102,								// bsr.s	3$
+	0x4ed1,								// jmp		(a1)
+	0x5280,								// 3$:	addq.l	#1,d0
+	0xd081,								// add.l	d1,d0
+	0x4e75,								// rts
+	0x5381,								// 2$:	subq.l	#1,d1
+	0x66f0,								// bne.s	1$
+	M68K_EMUL_BREAK, M68K_EXEC_RETURN
+};
+
+static uint64 call_insns(uint32 n) { return 4 + 11 * uint64(n) + 2; }
+
+static uint32 call_result(uint32 n)
+{
+	uint32 d0 = 0;
+	for (uint32 d1 = n; d1; d1--)
+		d0 += 2 * (1 + d1);
+	return d0;
+}
+
+// Patches the immediate operand of an instruction and pushes the
+// caches on each iteration, so every pass runs freshly translated code
+static const uint16 smc_code[] = {
+	0x223c, 0x0000, 0x0000,				// move.l	#n,d1
+	0x7000,								// moveq	#0,d0
+	0x33c1, 0x0001, 0x0012,				// 1$:	move.w	d1,2$+2
+	0xf4f8,								// cpusha	bc
+	0x0640, 0x0000,						// 2$:	addi.w	#0,d0
+	0x5381,								// subq.l	#1,d1
+	0x66f0,								// bne.s	1$
+	M68K_EMUL_BREAK, M68K_EXEC_RETURN
+};
+
+static uint64 smc_insns(uint32 n) { return 2 + 5 * uint64(n) + 2; }
+
+static uint32 smc_result(uint32 n)
+{
+	uint16 d0 = 0;
+	for (uint32 d1 = n; d1; d1--)
+		d0 += uint16(d1);
+	return d0;
+}
+
+struct bench_kernel {
+	const char *name;
+	const uint16 *code;
+	size_t code_size;
+	uint32 count;						// Iterations at scale 1
+	bool needs_fpu;
+	void (*setup)(void);
+	uint64 (*insns)(uint32 n);
+	uint32 (*result)(uint32 n);			// NULL to compare with the interpreter
+};
+
+#define KERNEL_CODE(x) x, sizeof(x)
+
+static const bench_kernel kernels[] = {
+	{"intloop", KERNEL_CODE(intloop_code), 100000000, false, NULL, intloop_insns, intloop_result},
+	{"memcpy", KERNEL_CODE(memcpy_code), 2000, false, memcpy_setup, memcpy_insns, memcpy_result},
+	{"fpu", KERNEL_CODE(fpu_code), 10000000, true, NULL, fpu_insns, fpu_result},
+	{"fpudbl", KERNEL_CODE(fpudbl_code), 10000000, true, NULL, fpudbl_insns, fpu_result},
+	{"fpusgl", KERNEL_CODE(fpusgl_code), 10000000, true, NULL, fpudbl_insns, NULL},
+	{"movem", KERNEL_CODE(movem_code), 20000000, false, NULL, movem_insns, movem_result},
+	{"call", KERNEL_CODE(call_code), 20000000, false, NULL, call_insns, call_result},
+	{"smc", KERNEL_CODE(smc_code), 50000, false, NULL, smc_insns, smc_result},
+};
+
+
+/*
+ *  Interrupt load
+ */
+
+static uint64 now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return uint64(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+static int32 irq_rate;
+static volatile bool irq_thread_cancel;
+static uint64 irq_raised_ns;			// When the pending interrupt was raised
+static uint64 irq_skipped;				// Periods skipped as the previous interrupt was still pending
+static uint64 irq_delivered, irq_latency_sum, irq_latency_max;
+
+static void *irq_func(void *arg)
+{
+	const uint64 period = 1000000000 / irq_rate;
+	uint64 next = now_ns();
+	while (!irq_thread_cancel) {
+		next += period;
+		struct timespec ts = {time_t(next / 1000000000), long(next % 1000000000)};
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) ;
+		if (InterruptFlags & INTFLAG_60HZ) {
+			irq_skipped++;
+			continue;
+		}
+		__atomic_store_n(&irq_raised_ns, now_ns(), __ATOMIC_RELAXED);
+		SetInterruptFlag(INTFLAG_60HZ);
+		TriggerInterrupt();
+	}
+	return NULL;
+}
+
+
+/*
+ *  SIGSEGV handler, for the write-protected translated pages of jitsmcprotect
+ */
+
+static sigsegv_return_t sigsegv_handler(sigsegv_info_t *sip)
+{
+#if USE_JIT
+	if (UseJIT && compiler_write_fault((void *)sigsegv_get_fault_address(sip)))
+		return SIGSEGV_RETURN_SUCCESS;
+#endif
+	return SIGSEGV_RETURN_FAILURE;
+}
+
+
+/*
+ *  EMUL_OP handler, only the opcodes used by the kernels are expected
+ */
+
+static bool have_result;
+static uint32 result;
+static bool faulted;
+
+void EmulOp(uint16 opcode, M68kRegisters *r)
+{
+	switch (opcode) {
+		case M68K_EMUL_BREAK:
+			have_result = true;
+			result = r->d[0];
+			break;
+		case M68K_EMUL_OP_SHUTDOWN:
+			faulted = true;
+			break;
+		case M68K_EMUL_OP_IRQ:
+			if (InterruptFlags & INTFLAG_60HZ) {
+				uint64 latency = now_ns() - __atomic_load_n(&irq_raised_ns, __ATOMIC_RELAXED);
+				ClearInterruptFlag(INTFLAG_60HZ);
+				irq_delivered++;
+				irq_latency_sum += latency;
+				if (latency > irq_latency_max)
+					irq_latency_max = latency;
+			}
+			break;
+		default:
+			fprintf(stderr, "unexpected EMUL_OP %04x\n", opcode);
+			faulted = true;
+			break;
+	}
+}
+
+
+/*
+ *  Run one kernel
+ */
+
+// Runs the kernel in memory with the interpreter and gets its result
+static bool interpreter_result(uint32 *d0)
+{
+#if USE_JIT
+	const bool use_jit = UseJIT;
+	UseJIT = false;
+#endif
+	have_result = faulted = false;
+	quit_program = false;
+	Start680x0();
+#if USE_JIT
+	UseJIT = use_jit;
+#endif
+	*d0 = result;
+	return have_result && !faulted;
+}
+
+static bool run(const char *name, const uint16 *code, size_t code_size, const bench_kernel *k, uint32 n)
+{
+	if (code_size > RAMSize - CODE_ADDR) {
+		fprintf(stderr, "%s: code too large\n", name);
+		return false;
+	}
+	for (size_t i = 0; i < code_size / 2; i++)
+		WriteMacInt16(CODE_ADDR + i * 2, code[i]);
+	uint32 expected = 0;
+	if (k) {
+		WriteMacInt32(CODE_ADDR + 2, n);
+		if (!k->result) {
+			flush_icache(0);
+			if (!interpreter_result(&expected)) {
+				printf("%-10s FAULT in the interpreter\n", name);
+				return false;
+			}
+		}
+		if (k->setup)
+			k->setup();
+	}
+	flush_icache(0);
+
+#if USE_JIT
+	compiler_stats before, after;
+	if (UseJIT)
+		compiler_get_stats(&before);
+#endif
+
+	pthread_t irq_thread;
+	irq_skipped = irq_delivered = irq_latency_sum = irq_latency_max = 0;
+	if (irq_rate > 0) {
+		irq_thread_cancel = false;
+		pthread_create(&irq_thread, NULL, irq_func, NULL);
+	}
+
+	have_result = faulted = false;
+	quit_program = false;
+	uint64 start = now_ns();
+	Start680x0();
+	double elapsed = (now_ns() - start) * 1e-9;
+
+	if (irq_rate > 0) {
+		irq_thread_cancel = true;
+		pthread_join(irq_thread, NULL);
+		ClearInterruptFlag(INTFLAG_60HZ);
+	}
+
+	printf("%-10s %8.3f s", name, elapsed);
+	if (k) {
+		uint64 insns = k->insns(n);
+		printf(" %9.2f MIPS", insns / elapsed * 1e-6);
+	}
+#if USE_JIT
+	if (UseJIT) {
+		compiler_get_stats(&after);
+		printf("  compile %6.3f s %7u blocks %8u bytes %5d flushes",
+			after.compile_seconds - before.compile_seconds,
+			after.compiled_blocks - before.compiled_blocks,
+			after.jitted_size,
+			(after.hard_flushes + after.soft_flushes) - (before.hard_flushes + before.soft_flushes));
+		if (after.evicted_blocks != before.evicted_blocks)
+			printf(" %u evicted", after.evicted_blocks - before.evicted_blocks);
+		if (after.untranslated_fpu != before.untranslated_fpu)
+			printf(" %u FPU insns interpreted", after.untranslated_fpu - before.untranslated_fpu);
+	}
+#endif
+
+	if (irq_rate > 0 && irq_delivered)
+		printf("  %llu irqs (%llu skipped), latency avg %.1f us max %.1f us",
+			(unsigned long long)irq_delivered, (unsigned long long)irq_skipped,
+			irq_latency_sum * 1e-3 / irq_delivered, irq_latency_max * 1e-3);
+
+	bool ok = !faulted;
+	if (faulted)
+		printf("  FAULT");
+	else if (k) {
+		if (k->result)
+			expected = k->result(n);
+		ok = have_result && result == expected;
+		if (ok)
+			printf("  ok");
+		else
+			printf("  WRONG RESULT %08x, expected %08x", result, expected);
+	} else if (have_result)
+		printf("  d0=%08x", result);
+#if USE_JIT
+	// With jitfpu, the FPU kernels are there to measure translated FPU code
+	if (UseJIT && k && k->needs_fpu && PrefsFindBool("jitfpu") &&
+		after.untranslated_fpu != before.untranslated_fpu) {
+		printf("  FPU NOT TRANSLATED");
+		ok = false;
+	}
+#endif
+	printf("\n");
+	return ok;
+}
+
+static uint16 *load_file(const char *path, size_t *size)
+{
+	FILE *f = fopen(path, "rb");
+	if (f == NULL) {
+		perror(path);
+		return NULL;
+	}
+	fseek(f, 0, SEEK_END);
+	long len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	uint8 *buf = (uint8 *)malloc(len + 1);
+	uint16 *code = (uint16 *)malloc(len + 1);
+	len = fread(buf, 1, len, f);
+	fclose(f);
+	for (long i = 0; i < len; i += 2)
+		code[i / 2] = (buf[i] << 8) | (i + 1 < len ? buf[i + 1] : 0);
+	free(buf);
+	*size = (len + 1) & ~1;
+	return code;
+}
+
+int main(int argc, char **argv)
+{
+	// Split the command line into pref overrides and kernels
+	const char *names[64];
+	int num_names = 0;
+	for (int i = 1; i < argc; i++) {
+		const char *eq = strchr(argv[i], '=');
+		if (eq && num_pref_args < MAX_PREF_ARGS) {
+			pref_args[num_pref_args][0] = strndup(argv[i], eq - argv[i]);
+			pref_args[num_pref_args][1] = eq + 1;
+			num_pref_args++;
+		} else if (num_names < 64)
+			names[num_names++] = argv[i];
+	}
+
+	CPUType = PrefsFindInt32("cpu");
+	FPUType = PrefsFindBool("fpu") ? 1 : 0;
+	irq_rate = PrefsFindInt32("irqrate");
+	int32 scale = PrefsFindInt32("scale");
+	if (scale < 1)
+		scale = 1;
+
+	if (!sigsegv_install_handler(sigsegv_handler)) {
+		fprintf(stderr, "cannot install SIGSEGV handler: %s\n", strerror(errno));
+		return 1;
+	}
+
+	// Mac RAM and ROM, laid out as by main_unix.cpp
+	vm_init();
+	RAMSize = PrefsFindInt32("ramsize") << 20;
+	if (RAMSize < 4 << 20)
+		RAMSize = 4 << 20;
+	ROMSize = 0x100000;
+	uint8 *ram_rom_area = (uint8 *)vm_acquire(RAMSize + ROMSize, VM_MAP_DEFAULT | VM_MAP_32BIT);
+	if (ram_rom_area == VM_MAP_FAILED) {
+		fprintf(stderr, "cannot allocate Mac memory\n");
+		return 1;
+	}
+	RAMBaseHost = ram_rom_area;
+	ROMBaseHost = RAMBaseHost + RAMSize;
+#if DIRECT_ADDRESSING
+	MEMBaseDiff = (uintptr)RAMBaseHost;
+#endif
+
+	if (!Init680x0()) {
+		fprintf(stderr, "cannot initialize 68k emulation\n");
+		return 1;
+	}
+
+	for (uint32 v = 0; v < 0x400; v += 4)
+		WriteMacInt32(v, VECTOR_STUB);
+	for (size_t i = 0; i < sizeof(vector_stub) / 2; i++)
+		WriteMacInt16(VECTOR_STUB + i * 2, vector_stub[i]);
+	WriteMacInt32(0x64, IRQ_STUB);		// Level 1 autovector
+	for (size_t i = 0; i < sizeof(irq_stub) / 2; i++)
+		WriteMacInt16(IRQ_STUB + i * 2, irq_stub[i]);
+	for (size_t i = 0; i < sizeof(reset_code) / 2; i++)
+		WriteMacInt16(ROMBaseMac + 0x2a + i * 2, reset_code[i]);
+
+#if USE_JIT
+	printf("CPU 680%d0%s, %s\n", CPUType, FPUType ? " with FPU" : "",
+		UseJIT ? "JIT compiler" : PrefsFindBool("predecode") ? "predecoding interpreter" : "interpreter");
+#else
+	printf("CPU 680%d0%s, %s\n", CPUType, FPUType ? " with FPU" : "",
+		PrefsFindBool("predecode") ? "predecoding interpreter" : "interpreter");
+#endif
+
+	const int num_kernels = sizeof(kernels) / sizeof(kernels[0]);
+	int failures = 0;
+	if (num_names == 0) {
+		for (int i = 0; i < num_kernels; i++) {
+			const bench_kernel *k = &kernels[i];
+			if (k->needs_fpu && !FPUType)
+				continue;
+			if (!run(k->name, k->code, k->code_size, k, k->count * scale))
+				failures++;
+		}
+	} else {
+		for (int j = 0; j < num_names; j++) {
+			const bench_kernel *k = NULL;
+			for (int i = 0; i < num_kernels; i++)
+				if (strcmp(kernels[i].name, names[j]) == 0)
+					k = &kernels[i];
+			if (k) {
+				if (!run(k->name, k->code, k->code_size, k, k->count * scale))
+					failures++;
+			} else {
+				size_t size;
+				uint16 *code = load_file(names[j], &size);
+				if (code == NULL || !run(names[j], code, size, NULL, 0))
+					failures++;
+				free(code);
+			}
+		}
+	}
+
+	Exit680x0();
+	vm_release(ram_rom_area, RAMSize + ROMSize);
+	vm_exit();
+	return failures ? 1 : 0;
+}
@@ -999,6 +999,7 @@ void ether_do_interrupt(void)
 			// Read packet from socket
 			struct sockaddr_in from;
 			socklen_t from_len = sizeof(from);
+			PrepareHostWrite(Mac2HostAddr(packet), 1514);
 			length = recvfrom(fd, Mac2HostAddr(packet), 1514, 0, (struct sockaddr *)&from, &from_len);
 			if (length < 14)
 				break;
@@ -1021,6 +1022,7 @@ void ether_do_interrupt(void)
 		{
 
 			// Read packet from sheep_net device
+			PrepareHostWrite(Mac2HostAddr(packet), 1516);
 #if defined(__linux__)
 			length = read(fd, Mac2HostAddr(packet), net_if_type == NET_IF_ETHERTAP ? 1516 : 1514);
 #else
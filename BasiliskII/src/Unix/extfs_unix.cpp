@@ -28,6 +28,7 @@
 #include <utime.h>
 
 #include "sysdeps.h"
+#include "main.h"
 #include "extfs.h"
 #include "extfs_defs.h"
 
@@ -315,6 +316,7 @@ void close_rfork(const char *path, int fd)
 
 ssize_t extfs_read(int fd, void *buffer, size_t length)
 {
+	PrepareHostWrite(buffer, length);
 	return read(fd, buffer, length);
 }
 
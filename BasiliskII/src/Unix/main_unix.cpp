@@ -93,8 +93,13 @@ using std::string;
 #include "sigsegv.h"
 #include "rpc.h"
 
+#if EMULATED_68K
+extern void predecode_flush(int); // from newcpu.cpp
+#endif
 #if USE_JIT
 extern void flush_icache_range(uint8 *start, uint32 size); // from compemu_support.cpp
+extern void compiler_prepare_write(void *start, uint32 size); // from compemu_support.cpp
+extern bool compiler_write_fault(void *fault_address); // from compemu_support.cpp
 #endif
 
 #ifdef ENABLE_MON
@@ -156,9 +161,11 @@ static volatile bool tick_thread_cancel = false;	// Flag: Cancel 60Hz thread
 static pthread_t tick_thread;						// 60Hz thread
 static pthread_attr_t tick_thread_attr;				// 60Hz thread attributes
 
+#ifndef __GNUC__
 static pthread_mutex_t intflag_lock = PTHREAD_MUTEX_INITIALIZER;	// Mutex to protect InterruptFlags
 #define LOCK_INTFLAGS pthread_mutex_lock(&intflag_lock)
 #define UNLOCK_INTFLAGS pthread_mutex_unlock(&intflag_lock)
+#endif
 
 #else
 
@@ -260,6 +267,12 @@ static sigsegv_return_t sigsegv_handler(sigsegv_info_t *sip)
 		return SIGSEGV_RETURN_SUCCESS;
 #endif
 
+#if USE_JIT
+	// Handle write to translated code
+	if (UseJIT && compiler_write_fault((void *)fault_address))
+		return SIGSEGV_RETURN_SUCCESS;
+#endif
+
 #ifdef HAVE_SIGSEGV_SKIP_INSTRUCTION
 	// Ignore writes to ROM
 	if (((uintptr)fault_address - (uintptr)ROMBaseHost) < ROMSize)
@@ -315,7 +328,7 @@ static int64 emulated_ticks_current = 0;
 static int32 emulated_ticks_quantum = 1000;
 int32 emulated_ticks = emulated_ticks_quantum;
 
-void cpu_do_check_ticks(void)
+static void cpu_do_check_host_ticks(void)
 {
 #if DEBUG
 	n_check_ticks++;
@@ -362,6 +375,61 @@ void cpu_do_check_ticks(void)
 	if (emulated_ticks <= 0)
 		emulated_ticks += emulated_ticks_quantum;
 }
+#else
+int32 emulated_ticks = 0x7fffffff;
+#endif
+
+
+/*
+ *  Deterministic timebase: with the "icount" prefs item set, the 60Hz tick
+ *  and the guest clocks are derived from the number of emulated instructions
+ *  instead of host time, so the same workload always executes the same way
+ */
+
+#if EMULATED_68K
+int32 icount_rate = 0;					// Instructions per virtual millisecond, 0 = use host time
+time_t icount_epoch;					// Host time at startup, base of TimerDateTime()
+static uint64 icount_insns = 0;			// Instructions executed before the current quantum
+static int32 icount_quantum = 0;		// Length of the current quantum
+static uint64 icount_ticks = 0;			// 60Hz ticks triggered so far
+
+static inline uint64 icount_next_tick(void)
+{
+	return (icount_ticks + 1) * 16625 * icount_rate / 1000;
+}
+
+uint64 icount_usec(void)
+{
+	return (icount_insns + icount_quantum - emulated_ticks) * 1000 / icount_rate;
+}
+
+void cpu_do_check_ticks(void)
+{
+	if (icount_rate == 0) {
+#ifdef USE_CPU_EMUL_SERVICES
+		cpu_do_check_host_ticks();
+#else
+		emulated_ticks = 0x7fffffff;	// Host threads trigger the interrupts
+#endif
+		return;
+	}
+
+	icount_insns += icount_quantum - emulated_ticks;
+	while (icount_insns >= icount_next_tick()) {
+		icount_ticks++;
+		one_tick();
+	}
+
+	uint64 left = icount_next_tick() - icount_insns;
+	icount_quantum = emulated_ticks = left > 0x40000000 ? 0x40000000 : left;
+}
+
+// The 68k is waiting for an interrupt, skip to the next tick
+void icount_skip(void)
+{
+	emulated_ticks = 0;
+	cpu_do_check_ticks();
+}
 #endif
 
 
@@ -499,6 +567,20 @@ int main(int argc, char **argv)
 	// Read preferences
 	PrefsInit(vmdir, argc, argv);
 
+#if EMULATED_68K
+	// Set up deterministic timebase
+	icount_rate = PrefsFindInt32("icount");
+	if (icount_rate < 0)
+		icount_rate = 0;
+	icount_epoch = time(NULL);
+	emulated_ticks = 0;
+#ifdef USE_CPU_EMUL_SERVICES
+	cpu_count_ticks = true;
+#else
+	cpu_count_ticks = icount_rate > 0;
+#endif
+#endif
+
 	// Any command line arguments left?
 	for (int i=1; i<argc; i++) {
 		if (argv[i][0] == '-') {
@@ -790,69 +872,76 @@ int main(int argc, char **argv)
 #endif
 
 #ifndef USE_CPU_EMUL_SERVICES
+#if EMULATED_68K
+	if (icount_rate > 0) {
+		D(bug("icount timebase, %d instructions per ms\n", icount_rate));
+	} else
+#endif
+	{
 #if defined(HAVE_PTHREADS)
 
-	// POSIX threads available, start 60Hz thread
-	Set_pthread_attr(&tick_thread_attr, 0);
-	tick_thread_active = (pthread_create(&tick_thread, &tick_thread_attr, tick_func, NULL) == 0);
-	if (!tick_thread_active) {
-		sprintf(str, GetString(STR_TICK_THREAD_ERR), strerror(errno));
-		ErrorAlert(str);
-		QuitEmulator();
-	}
-	D(bug("60Hz thread started\n"));
+		// POSIX threads available, start 60Hz thread
+		Set_pthread_attr(&tick_thread_attr, 0);
+		tick_thread_active = (pthread_create(&tick_thread, &tick_thread_attr, tick_func, NULL) == 0);
+		if (!tick_thread_active) {
+			sprintf(str, GetString(STR_TICK_THREAD_ERR), strerror(errno));
+			ErrorAlert(str);
+			QuitEmulator();
+		}
+		D(bug("60Hz thread started\n"));
 
 #elif defined(HAVE_TIMER_CREATE) && defined(_POSIX_REALTIME_SIGNALS)
 
-	// POSIX.4 timers and real-time signals available, start 60Hz timer
-	sigemptyset(&timer_sa.sa_mask);
-	timer_sa.sa_sigaction = (void (*)(int, siginfo_t *, void *))one_tick;
-	timer_sa.sa_flags = SA_SIGINFO | SA_RESTART;
-	if (sigaction(SIG_TIMER, &timer_sa, NULL) < 0) {
-		sprintf(str, GetString(STR_SIG_INSTALL_ERR), "SIG_TIMER", strerror(errno));
-		ErrorAlert(str);
-		QuitEmulator();
-	}
-	struct sigevent timer_event;
-	timer_event.sigev_notify = SIGEV_SIGNAL;
-	timer_event.sigev_signo = SIG_TIMER;
-	if (timer_create(CLOCK_REALTIME, &timer_event, &timer) < 0) {
-		sprintf(str, GetString(STR_TIMER_CREATE_ERR), strerror(errno));
-		ErrorAlert(str);
-		QuitEmulator();
-	}
-	struct itimerspec req;
-	req.it_value.tv_sec = 0;
-	req.it_value.tv_nsec = 16625000;
-	req.it_interval.tv_sec = 0;
-	req.it_interval.tv_nsec = 16625000;
-	if (timer_settime(timer, 0, &req, NULL) < 0) {
-		sprintf(str, GetString(STR_TIMER_SETTIME_ERR), strerror(errno));
-		ErrorAlert(str);
-		QuitEmulator();
-	}
-	D(bug("60Hz timer started\n"));
+		// POSIX.4 timers and real-time signals available, start 60Hz timer
+		sigemptyset(&timer_sa.sa_mask);
+		timer_sa.sa_sigaction = (void (*)(int, siginfo_t *, void *))one_tick;
+		timer_sa.sa_flags = SA_SIGINFO | SA_RESTART;
+		if (sigaction(SIG_TIMER, &timer_sa, NULL) < 0) {
+			sprintf(str, GetString(STR_SIG_INSTALL_ERR), "SIG_TIMER", strerror(errno));
+			ErrorAlert(str);
+			QuitEmulator();
+		}
+		struct sigevent timer_event;
+		timer_event.sigev_notify = SIGEV_SIGNAL;
+		timer_event.sigev_signo = SIG_TIMER;
+		if (timer_create(CLOCK_REALTIME, &timer_event, &timer) < 0) {
+			sprintf(str, GetString(STR_TIMER_CREATE_ERR), strerror(errno));
+			ErrorAlert(str);
+			QuitEmulator();
+		}
+		struct itimerspec req;
+		req.it_value.tv_sec = 0;
+		req.it_value.tv_nsec = 16625000;
+		req.it_interval.tv_sec = 0;
+		req.it_interval.tv_nsec = 16625000;
+		if (timer_settime(timer, 0, &req, NULL) < 0) {
+			sprintf(str, GetString(STR_TIMER_SETTIME_ERR), strerror(errno));
+			ErrorAlert(str);
+			QuitEmulator();
+		}
+		D(bug("60Hz timer started\n"));
 
 #else
 
-	// Start 60Hz timer
-	sigemptyset(&timer_sa.sa_mask);		// Block virtual 68k interrupts during SIGARLM handling
+		// Start 60Hz timer
+		sigemptyset(&timer_sa.sa_mask);		// Block virtual 68k interrupts during SIGARLM handling
 #if !EMULATED_68K
-	sigaddset(&timer_sa.sa_mask, SIG_IRQ);
+		sigaddset(&timer_sa.sa_mask, SIG_IRQ);
 #endif
-	timer_sa.sa_handler = one_tick;
-	timer_sa.sa_flags = SA_ONSTACK | SA_RESTART;
-	if (sigaction(SIGALRM, &timer_sa, NULL) < 0) {
-		sprintf(str, GetString(STR_SIG_INSTALL_ERR), "SIGALRM", strerror(errno));
-		ErrorAlert(str);
-		QuitEmulator();
-	}
-	struct itimerval req;
-	req.it_interval.tv_sec = req.it_value.tv_sec = 0;
-	req.it_interval.tv_usec = req.it_value.tv_usec = 16625;
-	setitimer(ITIMER_REAL, &req, NULL);
+		timer_sa.sa_handler = one_tick;
+		timer_sa.sa_flags = SA_ONSTACK | SA_RESTART;
+		if (sigaction(SIGALRM, &timer_sa, NULL) < 0) {
+			sprintf(str, GetString(STR_SIG_INSTALL_ERR), "SIGALRM", strerror(errno));
+			ErrorAlert(str);
+			QuitEmulator();
+		}
+		struct itimerval req;
+		req.it_interval.tv_sec = req.it_value.tv_sec = 0;
+		req.it_interval.tv_usec = req.it_value.tv_usec = 16625;
+		setitimer(ITIMER_REAL, &req, NULL);
 
 #endif
+	}
 #endif
 
 #ifdef USE_PTHREADS_SERVICES
@@ -979,6 +1068,10 @@ void FlushCodeCache(void *start, uint32 size)
 #if USE_JIT
     if (UseJIT)
 		flush_icache_range((uint8 *)start, size);
+    else
+		predecode_flush(0);
+#elif EMULATED_68K
+	predecode_flush(0);
 #endif
 #if !EMULATED_68K && defined(__NetBSD__)
 	m68k_sync_icache(start, size);
@@ -986,6 +1079,20 @@ void FlushCodeCache(void *start, uint32 size)
 }
 
 
+/*
+ *  Host I/O is about to write to Mac memory (e.g. with read()), make sure
+ *  the JIT compiler has no write-protected page there
+ */
+
+void PrepareHostWrite(void *start, uint32 size)
+{
+#if USE_JIT
+	if (UseJIT)
+		compiler_prepare_write(start, size);
+#endif
+}
+
+
 /*
  *  SIGINT handler, enters mon
  */
@@ -1124,7 +1231,18 @@ void B2_delete_mutex(B2_mutex *mutex)
 
 uint32 InterruptFlags = 0;
 
-#if EMULATED_68K
+#if EMULATED_68K && defined(__GNUC__)
+// Atomic updates, TriggerInterrupt() then publishes the flags to the CPU thread
+void SetInterruptFlag(uint32 flag)
+{
+	__atomic_fetch_or(&InterruptFlags, flag, __ATOMIC_RELEASE);
+}
+
+void ClearInterruptFlag(uint32 flag)
+{
+	__atomic_fetch_and(&InterruptFlags, ~flag, __ATOMIC_RELAXED);
+}
+#elif EMULATED_68K
 void SetInterruptFlag(uint32 flag)
 {
 	LOCK_INTFLAGS;
@@ -35,6 +35,7 @@ prefs_desc platform_prefs_items[] = {
 	{"dsp", TYPE_STRING, false,            "audio output (dsp) device name"},
 	{"mixer", TYPE_STRING, false,          "audio mixer device name"},
 	{"idlewait", TYPE_BOOLEAN, false,      "sleep when idle"},
+	{"icount", TYPE_INT32, false,          "derive guest time from the instruction count (instructions per ms, 0 = host time)"},
 #ifdef USE_SDL_VIDEO
 	{"sdlrender", TYPE_STRING, false,      "SDL_Renderer driver (\"auto\", \"software\" (may be faster), etc.)"},
 #endif
@@ -132,4 +133,5 @@ void AddPlatformPrefsDefaults(void)
 	PrefsReplaceString("mixer", "/dev/mixer");
 #endif
 	PrefsAddBool("idlewait", true);
+	PrefsAddInt32("icount", 0);
 }
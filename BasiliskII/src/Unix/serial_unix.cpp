@@ -732,6 +732,7 @@ void *XSERDPort::input_func(void *arg)
 		void *buf = Mac2HostAddr(ReadMacInt32(s->input_pb + ioBuffer));
 		uint32 length = ReadMacInt32(s->input_pb + ioReqCount);
 		D(bug("input_func waiting for %ld bytes of data...\n", length));
+		PrepareHostWrite(buf, length);
 		int32 actual = read(s->fd, buf, length);
 		D(bug(" %ld bytes received\n", actual));
 
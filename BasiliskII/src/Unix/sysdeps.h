@@ -126,6 +126,11 @@
 #undef USE_PTHREADS_SERVICES
 #endif
 
+/* Count emulated instructions (for periodic tasks or the "icount" timebase) */
+#if EMULATED_68K
+#define USE_CPU_EMUL_TICKS
+#endif
+
 
 /* Data types */
 typedef unsigned char uint8;
@@ -221,6 +226,12 @@ typedef uae_u32 uaecptr;
 extern uint64 GetTicks_usec(void);
 extern void Delay_usec(uint64 usec);
 
+/* Deterministic timebase (main_unix.cpp) */
+extern int32 icount_rate;			// Emulated instructions per virtual millisecond, 0 = use host time
+extern time_t icount_epoch;			// Host time at startup
+extern uint64 icount_usec(void);	// Virtual microseconds since startup
+extern void icount_skip(void);		// Advance virtual time to the next 60Hz tick
+
 /* Spinlocks */
 #ifdef __GNUC__
 
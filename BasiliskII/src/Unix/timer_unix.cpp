@@ -57,6 +57,14 @@ static inline void mach_current_time(tm_time_t &t) {
 void Microseconds(uint32 &hi, uint32 &lo)
 {
 	D(bug("Microseconds\n"));
+#if EMULATED_68K
+	if (icount_rate) {
+		uint64 tl = icount_usec();
+		hi = tl >> 32;
+		lo = tl;
+		return;
+	}
+#endif
 #if defined(__MACH__)
 	tm_time_t t;
 	mach_current_time(t);
@@ -81,6 +89,10 @@ void Microseconds(uint32 &hi, uint32 &lo)
 
 uint32 TimerDateTime(void)
 {
+#if EMULATED_68K
+	if (icount_rate)
+		return TimeToMacTime(icount_epoch + icount_usec() / 1000000);
+#endif
 	return TimeToMacTime(time(NULL));
 }
 
@@ -91,6 +103,18 @@ uint32 TimerDateTime(void)
 
 void timer_current_time(tm_time_t &t)
 {
+#if EMULATED_68K
+	if (icount_rate) {
+		uint64 usec = icount_usec();
+		t.tv_sec = usec / 1000000;
+#if defined(HAVE_CLOCK_GETTIME) || defined(__MACH__)
+		t.tv_nsec = (usec % 1000000) * 1000;
+#else
+		t.tv_usec = usec % 1000000;
+#endif
+		return;
+	}
+#endif
 #if defined(__MACH__)
 	mach_current_time(t);
 #elif defined(HAVE_CLOCK_GETTIME)
@@ -352,15 +376,33 @@ static int idle_sem_ok = -1;
 #endif
 #endif
 
+// Set by idle_resume() when the emulator thread was not waiting yet, so
+// that a wakeup racing with idle_wait() is not lost until the next one
+static bool idle_pending = false;
+
 void idle_wait(void)
 {
+#if EMULATED_68K
+	// Nothing but the next tick can happen in virtual time, don't sleep
+	if (icount_rate) {
+		icount_skip();
+		return;
+	}
+#endif
 #ifdef IDLE_USES_COND_WAIT
 	pthread_mutex_lock(&idle_lock);
-	pthread_cond_wait(&idle_cond, &idle_lock);
+	while (!idle_pending)
+		pthread_cond_wait(&idle_cond, &idle_lock);
+	idle_pending = false;
 	pthread_mutex_unlock(&idle_lock);
 #else
 #ifdef IDLE_USES_SEMAPHORE
 	LOCK_IDLE;
+	if (idle_pending) {
+		idle_pending = false;
+		UNLOCK_IDLE;
+		return;
+	}
 	if (idle_sem_ok < 0)
 		idle_sem_ok = (sem_init(&idle_sem, 0, 0) == 0);
 	if (idle_sem_ok > 0) {
@@ -385,7 +427,10 @@ void idle_wait(void)
 void idle_resume(void)
 {
 #ifdef IDLE_USES_COND_WAIT
+	pthread_mutex_lock(&idle_lock);
+	idle_pending = true;
 	pthread_cond_signal(&idle_cond);
+	pthread_mutex_unlock(&idle_lock);
 #else
 #ifdef IDLE_USES_SEMAPHORE
 	LOCK_IDLE;
@@ -395,6 +440,7 @@ void idle_resume(void)
 		sem_post(&idle_sem);
 		return;
 	}
+	idle_pending = true;
 	UNLOCK_IDLE;
 #endif
 #endif
@@ -510,11 +510,15 @@ static void *vm_acquire_framebuffer(uint32 size)
 	// always try to allocate framebuffer at the same address
 	static void *fb = VM_MAP_FAILED;
 	if (fb != VM_MAP_FAILED) {
-		if (vm_acquire_fixed(fb, size) < 0)
+		if (vm_acquire_fixed(fb, size, VM_MAP_DEFAULT | VM_MAP_WRITE_WATCH) < 0 && vm_acquire_fixed(fb, size) < 0)
 			fb = VM_MAP_FAILED;
 	}
-	if (fb == VM_MAP_FAILED)
-		fb = vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT);
+	if (fb == VM_MAP_FAILED) {
+		// Prefer memory the host tracks writes to, VOSF then needs no page faults
+		fb = vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT | VM_MAP_WRITE_WATCH);
+		if (fb == VM_MAP_FAILED)
+			fb = vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT);
+	}
 	return fb;
 }
 
@@ -1545,9 +1549,11 @@ bool X11_monitor_desc::video_open(void)
 
 #ifdef ENABLE_VOSF
 	// Load gray ramp to 8->16/32 expand map
-	if (!IsDirectMode(mode) && xdepth > 8)
+	if (!IsDirectMode(mode) && xdepth > 8) {
 		for (int i=0; i<256; i++)
 			ExpandMap[i] = map_rgb(i, i, i, true);
+		Screen_expand_map_changed();
+	}
 #endif
 
 	// Create display driver object of requested type
@@ -1919,6 +1925,7 @@ void X11_monitor_desc::set_palette(uint8 *pal, int num_in)
 			int c = i & (num_in-1); // If there are less than 256 colors, we repeat the first entries (this makes color expansion easier)
 			ExpandMap[i] = map_rgb(pal[c*3+0], pal[c*3+1], pal[c*3+2], true);
 		}
+		Screen_expand_map_changed();
 
 		// We have to redraw everything because the interpretation of pixel values changed
 		LOCK_VOSF;
@@ -2537,7 +2544,7 @@ static void video_refresh_dga_vosf(void)
 	static int tick_counter = 0;
 	if (++tick_counter >= frame_skip) {
 		tick_counter = 0;
-		if (mainBuffer.dirty) {
+		if (vosf_check_dirty()) {
 			LOCK_VOSF;
 			update_display_dga_vosf(static_cast<driver_dga *>(drv));
 			UNLOCK_VOSF;
@@ -2555,7 +2562,7 @@ static void video_refresh_window_vosf(void)
 	static int tick_counter = 0;
 	if (++tick_counter >= frame_skip) {
 		tick_counter = 0;
-		if (mainBuffer.dirty) {
+		if (vosf_check_dirty()) {
 			XDisplayLock();
 			LOCK_VOSF;
 			update_display_window_vosf(static_cast<driver_window *>(drv));
@@ -328,6 +328,7 @@ void close_rfork(const char *path, int fd)
 
 ssize_t extfs_read(int fd, void *buffer, size_t length)
 {
+	PrepareHostWrite(buffer, length);
 	return read(fd, buffer, length);
 }
 
@@ -53,8 +53,13 @@ typedef std::basic_string<wchar_t> tstring;
 #include <windows.h>
 #include <comdlg.h>
 
+#if EMULATED_68K
+extern void predecode_flush(int); // from newcpu.cpp
+#endif
 #if USE_JIT
 extern void flush_icache_range(uint8 *start, uint32 size); // from compemu_support.cpp
+extern void compiler_prepare_write(void *start, uint32 size); // from compemu_support.cpp
+extern bool compiler_write_fault(void *fault_address); // from compemu_support.cpp
 #endif
 
 #ifdef ENABLE_MON
@@ -150,6 +155,12 @@ static sigsegv_return_t sigsegv_handler(sigsegv_info_t *sip)
 		return SIGSEGV_RETURN_SUCCESS;
 #endif
 
+#if USE_JIT
+	// Handle write to translated code
+	if (UseJIT && compiler_write_fault((void *)fault_address))
+		return SIGSEGV_RETURN_SUCCESS;
+#endif
+
 #ifdef HAVE_SIGSEGV_SKIP_INSTRUCTION
 	// Ignore writes to ROM
 	if (((uintptr)fault_address - (uintptr)ROMBaseHost) < ROMSize)
@@ -644,6 +655,24 @@ void FlushCodeCache(void *start, uint32 size)
 #if USE_JIT
     if (UseJIT)
 		flush_icache_range((uint8 *)start, size);
+    else
+		predecode_flush(0);
+#elif EMULATED_68K
+	predecode_flush(0);
+#endif
+}
+
+
+/*
+ *  Host I/O is about to write to Mac memory (e.g. with ReadFile()), make
+ *  sure the JIT compiler has no write-protected page there
+ */
+
+void PrepareHostWrite(void *start, uint32 size)
+{
+#if USE_JIT
+	if (UseJIT)
+		compiler_prepare_write(start, size);
 #endif
 }
 
@@ -603,6 +603,8 @@ size_t Sys_read(void *arg, void *buffer, loff_t offset, size_t length)
 	if (!fh)
 		return 0;
 
+	PrepareHostWrite(buffer, length);
+
 #if defined(BINCUE)
 	if (fh->is_bincue)
 		return read_bincue(fh->bincue_fd, buffer, offset, length);
@@ -209,6 +209,7 @@ static idle_sentinel idle_sentinel;
 
 static int idle_sem_ok = -1;
 static HANDLE idle_sem = NULL;
+static bool idle_pending = false;	// idle_resume() called while nobody was waiting
 
 static HANDLE idle_lock = NULL;
 #define LOCK_IDLE WaitForSingleObject(idle_lock, INFINITE)
@@ -238,6 +239,11 @@ idle_sentinel::~idle_sentinel()
 void idle_wait(void)
 {
 	LOCK_IDLE;
+	if (idle_pending) {
+		idle_pending = false;
+		UNLOCK_IDLE;
+		return;
+	}
 	if (idle_sem_ok > 0) {
 		idle_sem_ok++;
 		UNLOCK_IDLE;
@@ -264,5 +270,6 @@ void idle_resume(void)
 		ReleaseSemaphore(idle_sem, 1, NULL);
 		return;
 	}
+	idle_pending = true;
 	UNLOCK_IDLE;
 }
@@ -44,6 +44,7 @@ extern void ExitAll(void);
 
 // Platform-specific functions
 extern void FlushCodeCache(void *start, uint32 size);	// Code was patched, flush caches if neccessary
+extern void PrepareHostWrite(void *start, uint32 size);	// Host I/O is about to write to Mac memory (Unix and Windows only)
 extern void QuitEmulator(void);							// Quit emulator
 extern void ErrorAlert(const char *text);				// Display error alert
 extern void ErrorAlert(int string_id);
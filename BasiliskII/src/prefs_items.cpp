@@ -56,6 +56,8 @@ prefs_desc common_prefs_items[] = {
 	{"modelid", TYPE_INT32, false,    "Mac Model ID (Gestalt Model ID minus 6)"},
 	{"cpu", TYPE_INT32, false,        "CPU type (0 = 68000, 1 = 68010 etc.)"},
 	{"fpu", TYPE_BOOLEAN, false,      "enable FPU emulation"},
+	{"predecode", TYPE_BOOLEAN, false, "cache decoded instruction handlers in the interpreter"},
+	{"idledetect", TYPE_BOOLEAN, false, "sleep while the guest polls Ticks in a loop"},
 	{"nocdrom", TYPE_BOOLEAN, false,  "don't install CD-ROM driver"},
 	{"nosound", TYPE_BOOLEAN, false,  "don't enable sound output"},
 	{"noclipconversion", TYPE_BOOLEAN, false, "don't convert clipboard contents"},
@@ -65,7 +67,13 @@ prefs_desc common_prefs_items[] = {
 	{"jitdebug", TYPE_BOOLEAN, false,    "enable JIT debugger (requires mon builtin)"},
 	{"jitcachesize", TYPE_INT32, false,  "translation cache size in KB"},
 	{"jitlazyflush", TYPE_BOOLEAN, false, "enable lazy invalidation of translation cache"},
+	{"jitsmcprotect", TYPE_BOOLEAN, false, "write-protect RAM pages holding translated code"},
+	{"jitthread", TYPE_BOOLEAN, false,   "translate hot blocks in a separate thread"},
 	{"jitinline", TYPE_BOOLEAN, false,   "enable translation through constant jumps"},
+	{"jittrace", TYPE_BOOLEAN, false,    "translate hot blocks again as traces through conditional branches"},
+	{"jitpredict", TYPE_BOOLEAN, false,  "go straight to predicted targets of indirect jumps and returns"},
+	{"jitprofile", TYPE_BOOLEAN, false,  "gather statistics on translated code and write a perf map"},
+	{"jitromcache", TYPE_STRING, false,  "file to keep translations of ROM code in across runs"},
 	{"jitblacklist", TYPE_STRING, false, "blacklist opcodes from translation"},
 	{"keyboardtype", TYPE_INT32, false, "hardware keyboard type"},
 	{"keycodes", TYPE_BOOLEAN, false, "use keycodes rather than keysyms to decode keyboard"},
@@ -103,6 +111,8 @@ void AddPrefsDefaults(void)
 	PrefsAddInt32("cpu", 3);		// 68030
 	PrefsAddInt32("displaycolordepth", 0);
 	PrefsAddBool("fpu", false);
+	PrefsAddBool("predecode", false);
+	PrefsAddBool("idledetect", false);
 	PrefsAddBool("nocdrom", false);
 	PrefsAddBool("nosound", false);
 	PrefsAddBool("noclipconversion", false);
@@ -115,7 +125,12 @@ void AddPrefsDefaults(void)
 	PrefsAddBool("jitdebug", false);
 	PrefsAddInt32("jitcachesize", 8192);
 	PrefsAddBool("jitlazyflush", true);
+	PrefsAddBool("jitsmcprotect", false);
+	PrefsAddBool("jitthread", false);
 	PrefsAddBool("jitinline", true);
+	PrefsAddBool("jittrace", false);
+	PrefsAddBool("jitpredict", false);
+	PrefsAddBool("jitprofile", false);
 #else
 	PrefsAddBool("jit", false);
 #endif
@@ -59,6 +59,8 @@ bool UseJIT = false;
 // From newcpu.cpp
 extern bool quit_program;
 
+static bool idle_detect = false;	// Flag: detect guest polling loops ("idledetect" pref)
+
 
 /*
  *  Initialize 680x0 emulation, CheckROM() must have been called first
@@ -101,7 +103,10 @@ bool Init680x0(void)
 	UseJIT = compiler_use_jit();
 	if (UseJIT)
 	    compiler_init();
+	else
+	    flush_icache = predecode_flush;
 #endif
+	idle_detect = PrefsFindBool("idledetect");
 	return true;
 }
 
@@ -153,8 +158,9 @@ void Start680x0(void)
 
 void TriggerInterrupt(void)
 {
-	idle_resume();
+	// Set the flag first, the woken up thread checks it before sleeping again
 	SPCFLAGS_SET( SPCFLAG_INT );
+	idle_resume();
 }
 
 void TriggerNMI(void)
@@ -169,7 +175,289 @@ void TriggerNMI(void)
 
 int intlev(void)
 {
-	return InterruptFlags ? 1 : 0;
+	// Pairs with the release of SetInterruptFlag(), see spcflags.h
+#if defined(__GNUC__)
+	return __atomic_load_n(&InterruptFlags, __ATOMIC_ACQUIRE) ? 1 : 0;
+#else
+	return *(volatile uint32 *)&InterruptFlags ? 1 : 0;
+#endif
+}
+
+
+/*
+ *  Guest idle detection: programs that wait for Ticks to change in a tight
+ *  loop instead of calling SynchIdleTime() are put to sleep until the next
+ *  interrupt. The loop is found by sampling the PCs interrupts are taken
+ *  at; it must only read Ticks and change the stack and registers it
+ *  loads again on every pass.
+ */
+
+const int IDLE_SAMPLES = 8;				// Interrupts that must hit the same code
+const int IDLE_WINDOWS = 4;				// Code areas covered by the loop (loop, trap dispatcher, ...)
+const uint32 IDLE_WINDOW_SIZE = 256;
+const int IDLE_MAX_LOOP_INSNS = 32;
+const int IDLE_CHECK_BUDGET = 50000;	// Checks to wait for the interrupt handler to return
+const uint32 TICKS = 0x16a;				// Ticks low memory global
+const uint16 TICK_COUNT_TRAP = 0xa975;	// _TickCount
+
+static uaecptr idle_windows[IDLE_WINDOWS];	// Code areas interrupts were taken in
+static int idle_num_windows = 0;
+static uaecptr idle_samples[IDLE_SAMPLES];	// PCs interrupts were taken at
+static int idle_num_samples = 0;
+static uaecptr idle_loop_start, idle_loop_end;	// Polling loop found, [start, end) (idle_loop_end != 0)
+static int idle_budget;
+static int idle_passes;
+
+static bool idle_code_address(uaecptr addr)
+{
+	return addr - RAMBaseMac < RAMSize || addr - ROMBaseMac < ROMSize;
+}
+
+// Size of the extension words of an operand, or -1 if not handled
+static int idle_ea_size(amodes mode, wordsizes size, uaecptr ext)
+{
+	switch (mode) {
+		case Dreg: case Areg: case Aind: case Aipi: case Apdi: case immi:
+			return 0;
+		case Ad16: case PC16: case absw: case imm0: case imm1:
+			return 2;
+		case absl: case imm2:
+			return 4;
+		case imm:
+			return size == sz_long ? 4 : 2;
+		case Ad8r: case PC8r:
+			return (get_word(ext) & 0x100) ? -1 : 2;	// Full extension format not handled
+		default:
+			return -1;
+	}
+}
+
+// Registers a polling loop changes, bits 0-7 for D0-D7 and 8-15 for A0-A7.
+// Sleeping through the loop must not change what it computes, so every
+// register it changes has to get a new value from memory or a constant
+// on each pass before it is changed based on its own value. A register
+// that counts passes rules the loop out.
+struct idle_regs {
+	bool check;			// False to only collect the registers written
+	uae_u16 written;	// Registers written anywhere in the loop
+	uae_u16 loaded;		// Registers given a new value so far in this pass
+};
+
+// Register r gets a value from memory, a constant or the registers in sources
+static bool idle_load(idle_regs *ir, int r, uae_u16 sources)
+{
+	if (ir == NULL)
+		return true;
+	if (!ir->check) {
+		ir->written |= 1 << r;
+		return true;
+	}
+	if (sources & ir->written & ~ir->loaded)	// Copy of the previous pass
+		return false;
+	ir->loaded |= 1 << r;
+	return true;
+}
+
+// Register r is changed based on its own value
+static bool idle_update(idle_regs *ir, int r)
+{
+	if (ir == NULL || r == 15)	// The stack pointer, as long as the loop keeps the stack balanced
+		return true;
+	if (!ir->check) {
+		ir->written |= 1 << r;
+		return true;
+	}
+	return (ir->loaded & (1 << r)) != 0;
+}
+
+// Decode an instruction of a polling loop candidate, returns its length or 0
+// if it may change memory other than the stack (or is not handled at all).
+// With ir, also 0 if it changes a register in a way the loop can't have.
+static int idle_decode(uaecptr pc, bool *reads_ticks, uaecptr *target, idle_regs *ir)
+{
+	if (!idle_code_address(pc) || !idle_code_address(pc + 10))
+		return 0;
+	uae_u16 opcode = get_word(pc);
+	*target = 0;
+	if (opcode == TICK_COUNT_TRAP) {
+		*reads_ticks = true;
+		return 2;
+	}
+
+	const struct instr *dp = &table68k[opcode];
+	bool writes = true;
+	bool load = false;		// The value written does not depend on the one before
+	switch (dp->mnemo) {
+		case i_CMP: case i_CMPA: case i_CMPM: case i_TST: case i_BTST: case i_NOP:
+			writes = false;
+			break;
+		case i_Bcc: {
+			uae_s32 disp = (uae_s8)opcode;
+			if (disp == 0)
+				disp = (uae_s16)get_word(pc + 2);
+			else if (disp == -1)
+				disp = get_long(pc + 2);
+			*target = pc + 2 + disp;
+			writes = false;
+			break;
+		}
+		case i_DBcc:
+			*target = pc + 2 + (uae_s16)get_word(pc + 2);
+			if (!idle_update(ir, dp->sreg))	// The counter
+				return 0;
+			writes = false;
+			break;
+		case i_MOVE: case i_MOVEA: case i_LEA: case i_CLR: case i_Scc:
+			load = true;
+			break;
+		case i_EXG:
+			if (!idle_update(ir, (dp->smode == Areg ? 8 : 0) + dp->sreg))
+				return 0;
+			break;
+		case i_ADD: case i_ADDA: case i_SUB: case i_SUBA:
+		case i_AND: case i_OR: case i_EOR: case i_NOT: case i_NEG:
+		case i_EXT: case i_SWAP: case i_MULU: case i_MULS:
+		case i_ASR: case i_ASL: case i_LSR: case i_LSL: case i_ROL: case i_ROR:
+			break;
+		default:
+			return 0;
+	}
+
+	int len = 2;
+	uae_u16 sources = 0;	// Registers the value loaded is copied or computed from
+	for (int i = 0; i < 2; i++) {
+		if (!(i == 0 ? dp->suse : dp->duse))
+			continue;
+		amodes mode = (amodes)(i == 0 ? dp->smode : dp->dmode);
+		int reg = i == 0 ? dp->sreg : dp->dreg;
+		int n = idle_ea_size(mode, (wordsizes)dp->size, pc + len);
+		if (n < 0)
+			return 0;
+		if ((mode == absw && (uae_s16)get_word(pc + len) == TICKS) || (mode == absl && get_long(pc + len) == TICKS))
+			*reads_ticks = true;
+
+		// The operand written is the destination, or the only operand
+		bool written = writes && (i == 1 || !dp->duse);
+		if (written && mode != Dreg && mode != Areg
+		 && !(reg == 7 && (mode == Aind || mode == Aipi || mode == Apdi || mode == Ad16)))
+			return 0;
+		if ((mode == Aipi || mode == Apdi) && !idle_update(ir, 8 + reg))
+			return 0;
+		if (written && (mode == Dreg || mode == Areg)) {
+			int r = (mode == Areg ? 8 : 0) + reg;
+			if (!(load ? idle_load(ir, r, sources) : idle_update(ir, r)))
+				return 0;
+		} else if (!written) {
+			if (mode == Dreg)
+				sources |= 1 << reg;
+			else if (mode == Areg)
+				sources |= 1 << (8 + reg);
+			else if (dp->mnemo == i_LEA && (mode == Aind || mode == Ad16 || mode == Ad8r)) {
+				sources |= 1 << (8 + reg);
+				if (mode == Ad8r)
+					sources |= 1 << (get_word(pc + len) >> 12);	// Index register
+			}
+		}
+		len += n;
+	}
+	return len;
+}
+
+// Find a polling loop through pc, closed by a backward branch. The loop
+// is [*start, *end), its branch included.
+static bool idle_find_loop(uaecptr pc, uaecptr *start, uaecptr *end)
+{
+	uaecptr p = pc, target, loop_start = 0, loop_end = 0;
+	bool reads_ticks = false;
+	for (int i = 0; i < IDLE_MAX_LOOP_INSNS && loop_end == 0; i++) {
+		int len = idle_decode(p, &reads_ticks, &target, NULL);
+		if (len == 0)
+			return false;
+		p += len;
+		if (target && target <= pc && pc - target < IDLE_WINDOW_SIZE) {
+			loop_start = target;
+			loop_end = p;
+		}
+	}
+	if (loop_end == 0)
+		return false;
+
+	// The whole loop must qualify, not only the part after pc. The first
+	// pass collects the registers written, the second one checks how.
+	idle_regs ir = {false, 0, 0};
+	for (int check = 0; check < 2; check++) {
+		ir.check = check != 0;
+		reads_ticks = false;
+		p = loop_start;
+		for (int i = 0; i < IDLE_MAX_LOOP_INSNS && p < loop_end; i++) {
+			int len = idle_decode(p, &reads_ticks, &target, &ir);
+			if (len == 0)
+				return false;
+			p += len;
+		}
+		if (p != loop_end)
+			return false;
+	}
+	if (!reads_ticks)
+		return false;
+	*start = loop_start;
+	*end = loop_end;
+	return true;
+}
+
+// An interrupt is taken at pc, returns true if the guest is idle and the
+// CPU should look for the handler returning to the loop
+bool idle_detect_interrupt(uaecptr pc)
+{
+	if (!idle_detect)
+		return false;
+
+	// Busy code moves around, a polling loop stays in the same few places
+	uaecptr window = pc & ~(IDLE_WINDOW_SIZE - 1);
+	int i;
+	for (i = 0; i < idle_num_windows; i++)
+		if (idle_windows[i] == window)
+			break;
+	if (i == idle_num_windows) {
+		if (idle_num_windows == IDLE_WINDOWS) {
+			idle_num_windows = idle_num_samples = 0;
+			idle_loop_end = 0;
+		}
+		idle_windows[idle_num_windows++] = window;
+	}
+
+	// Only interrupts taken in the loop found
+	if (idle_loop_end) {
+		if (pc - idle_loop_start >= idle_loop_end - idle_loop_start)
+			return false;
+		idle_budget = IDLE_CHECK_BUDGET;
+		idle_passes = 0;
+		return true;
+	}
+
+	idle_samples[idle_num_samples++] = pc;
+	if (idle_num_samples == IDLE_SAMPLES) {
+		for (i = 0; i < IDLE_SAMPLES; i++)
+			if (idle_find_loop(idle_samples[i], &idle_loop_start, &idle_loop_end))
+				break;
+		idle_num_samples = 0;
+	}
+	return false;
+}
+
+// Called with SPCFLAG_IDLE set, sleeps once the interrupt handler returned
+// and the loop went around again. Returns false when done.
+bool idle_detect_check(uaecptr pc)
+{
+	if (--idle_budget <= 0)
+		return false;
+	if (pc != idle_loop_start || regs.intmask != 0 || SPCFLAGS_TEST( SPCFLAG_INT | SPCFLAG_DOINT ))
+		return true;
+	if (++idle_passes < 2)
+		return true;
+	while (!SPCFLAGS_TEST( SPCFLAG_INT ))
+		idle_wait();
+	return false;
 }
 
 
@@ -38257,6 +38257,389 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 }}}}}	 if (m68k_pc_offset>100) sync_m68k_pc();
 	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
 }
+void REGPARAM2 op_f200_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,Dn */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f208_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,An */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f210_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,(An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f218_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,(An)+ */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f220_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,-(An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f228_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,(d16,An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f230_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,(d8,An,Xn) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f238_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,(xxx).W */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f239_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,(xxx).L */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f23a_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,(d16,PC) */
+{
+	uae_s32 dstreg = 2;
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f23b_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,(d8,PC,Xn) */
+{
+	uae_s32 dstreg = 3;
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f23c_0_comp_ff(uae_u32 opcode) /* FPP.L #<data>.W,#<data>.L */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f240_0_comp_ff(uae_u32 opcode) /* FScc.L #<data>.W,Dn */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f250_0_comp_ff(uae_u32 opcode) /* FScc.L #<data>.W,(An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f258_0_comp_ff(uae_u32 opcode) /* FScc.L #<data>.W,(An)+ */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f260_0_comp_ff(uae_u32 opcode) /* FScc.L #<data>.W,-(An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f268_0_comp_ff(uae_u32 opcode) /* FScc.L #<data>.W,(d16,An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f270_0_comp_ff(uae_u32 opcode) /* FScc.L #<data>.W,(d8,An,Xn) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f278_0_comp_ff(uae_u32 opcode) /* FScc.L #<data>.W,(xxx).W */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f279_0_comp_ff(uae_u32 opcode) /* FScc.L #<data>.W,(xxx).L */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f280_0_comp_ff(uae_u32 opcode) /* FBcc.L #<data>,#<data>.W */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 63);
+#else
+	uae_s32 srcreg = (opcode & 63);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fbcc_opp(opcode);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f2c0_0_comp_ff(uae_u32 opcode) /* FBcc.L #<data>,#<data>.L */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 63);
+#else
+	uae_s32 srcreg = (opcode & 63);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fbcc_opp(opcode);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
 void REGPARAM2 op_f600_0_comp_ff(uae_u32 opcode) /* MOVE16.L (An)+,(xxx).L */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -72403,6 +72786,389 @@ if ((uae_u32)srcreg==(uae_u32)dstreg) {
 }}}}}	 if (m68k_pc_offset>100) sync_m68k_pc();
 	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
 }
+void REGPARAM2 op_f200_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,Dn */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f208_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,An */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f210_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,(An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f218_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,(An)+ */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f220_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,-(An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f228_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,(d16,An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f230_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,(d8,An,Xn) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f238_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,(xxx).W */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f239_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,(xxx).L */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f23a_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,(d16,PC) */
+{
+	uae_s32 dstreg = 2;
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f23b_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,(d8,PC,Xn) */
+{
+	uae_s32 dstreg = 3;
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f23c_0_comp_nf(uae_u32 opcode) /* FPP.L #<data>.W,#<data>.L */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fpp_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f240_0_comp_nf(uae_u32 opcode) /* FScc.L #<data>.W,Dn */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f250_0_comp_nf(uae_u32 opcode) /* FScc.L #<data>.W,(An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f258_0_comp_nf(uae_u32 opcode) /* FScc.L #<data>.W,(An)+ */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f260_0_comp_nf(uae_u32 opcode) /* FScc.L #<data>.W,-(An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f268_0_comp_nf(uae_u32 opcode) /* FScc.L #<data>.W,(d16,An) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f270_0_comp_nf(uae_u32 opcode) /* FScc.L #<data>.W,(d8,An,Xn) */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f278_0_comp_nf(uae_u32 opcode) /* FScc.L #<data>.W,(xxx).W */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f279_0_comp_nf(uae_u32 opcode) /* FScc.L #<data>.W,(xxx).L */
+{
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+	uae_u16 extra=comp_get_iword((m68k_pc_offset+=2)-2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fscc_opp(opcode,extra);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f280_0_comp_nf(uae_u32 opcode) /* FBcc.L #<data>,#<data>.W */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 63);
+#else
+	uae_s32 srcreg = (opcode & 63);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fbcc_opp(opcode);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
+void REGPARAM2 op_f2c0_0_comp_nf(uae_u32 opcode) /* FBcc.L #<data>,#<data>.L */
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 63);
+#else
+	uae_s32 srcreg = (opcode & 63);
+#endif
+	uae_u32 dodgy=0;
+	uae_u32 m68k_pc_offset_thisinst=m68k_pc_offset;
+	m68k_pc_offset+=2;
+{	uae_u8 scratchie=S1;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = do_byteswap_16(opcode);
+#endif
+	comp_fbcc_opp(opcode);
+}	 if (m68k_pc_offset>100) sync_m68k_pc();
+	if (failure)  m68k_pc_offset=m68k_pc_offset_thisinst;
+}
 void REGPARAM2 op_f600_0_comp_nf(uae_u32 opcode) /* MOVE16.L (An)+,(xxx).L */
 {
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -98,6 +98,15 @@ uae_s8 can_byte[]={0,1,2,3,-1};
 uae_s8 can_word[]={0,1,2,3,5,6,7,-1};
 #endif
 
+/* Registers that may hold the most used 68k registers of a block for its
+   whole lifetime. They are callee-saved, so the values survive the calls
+   compiled code makes to C helpers */
+#if defined(__x86_64__)
+uae_s8 pinned_regs[]={3,5,12,13,14,15,-1};
+#else
+uae_s8 pinned_regs[]={-1};
+#endif
+
 #if USE_OPTIMIZED_CALLS
 /* Make sure interpretive core does not use cpuopti */
 uae_u8 call_saved[]={0,0,0,1,1,1,1,1};
@@ -711,13 +720,13 @@ LOWFUNC(NONE,READ,5,raw_mov_b_brrm_indexed,(W1 d, IMM base, R4 baser, R4 index,
 }
 LENDFUNC(NONE,READ,5,raw_mov_b_brrm_indexed,(W1 d, IMM base, R4 baser, R4 index, IMM factor))
 
-LOWFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor))
+LOWFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor))
 {
 	ADDR32 MOVLmr(base, X86_NOREG, index, factor, d);
 }
-LENDFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor))
+LENDFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor))
 
-LOWFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor, IMM cond))
+LOWFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor, IMM cond))
 {
 	if (have_cmov)
 		ADDR32 CMOVLmr(cond, base, X86_NOREG, index, factor, d);
@@ -728,9 +737,9 @@ LOWFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor,
 	    *target_p = (uintptr)x86_get_target() - ((uintptr)target_p + 1);
 	}
 }
-LENDFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor, IMM cond))
+LENDFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor, IMM cond))
 
-LOWFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, IMM mem, IMM cond))
+LOWFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, MEMR mem, IMM cond))
 {
 	if (have_cmov)
 		CMOVLmr(cond, mem, X86_NOREG, X86_NOREG, 1, d);
@@ -741,7 +750,54 @@ LOWFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, IMM mem, IMM cond))
 	    *target_p = (uintptr)x86_get_target() - ((uintptr)target_p + 1);
 	}
 }
-LENDFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, IMM mem, IMM cond))
+LENDFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, MEMR mem, IMM cond))
+
+/* Host pointers: 64-bit wide on x86-64, so that the translation cache and
+   the tables it dispatches through can live anywhere */
+LOWFUNC(NONE,NONE,2,raw_mov_p_ri,(W4 d, MEMR s))
+{
+#if defined(__x86_64__)
+	if (s <= 0xffffffff)
+		MOVLir(s, d);
+	else if (_x86_RIP_addressing_possible(s, 0))
+		LEAQmr(s, X86_NOREG, X86_NOREG, 1, d);
+	else
+		MOVQir(s, d);
+#else
+	MOVLir(s, d);
+#endif
+}
+LENDFUNC(NONE,NONE,2,raw_mov_p_ri,(W4 d, MEMR s))
+
+LOWFUNC(NONE,READ,5,raw_cmov_p_rrm_indexed,(W4 d, R4 baser, R4 index, IMM factor, IMM cond))
+{
+#if defined(__x86_64__)
+	if (have_cmov)
+		CMOVQmr(cond, 0, baser, index, factor, d);
+	else { /* replacement using branch and mov */
+		int8 *target_p = (int8 *)x86_get_target() + 1;
+		JCCSii(cond^1, 0);
+		MOVQmr(0, baser, index, factor, d);
+	    *target_p = (uintptr)x86_get_target() - ((uintptr)target_p + 1);
+	}
+#else
+	if (have_cmov)
+		CMOVLmr(cond, 0, baser, index, factor, d);
+	else { /* replacement using branch and mov */
+		int8 *target_p = (int8 *)x86_get_target() + 1;
+		JCCSii(cond^1, 0);
+		MOVLmr(0, baser, index, factor, d);
+	    *target_p = (uintptr)x86_get_target() - ((uintptr)target_p + 1);
+	}
+#endif
+}
+LENDFUNC(NONE,READ,5,raw_cmov_p_rrm_indexed,(W4 d, R4 baser, R4 index, IMM factor, IMM cond))
+
+LOWFUNC(NONE,READ,3,raw_jmp_rm_indexed,(R4 baser, R4 index, IMM factor))
+{
+	JMPsm(0, baser, index, factor);
+}
+LENDFUNC(NONE,READ,3,raw_jmp_rm_indexed,(R4 baser, R4 index, IMM factor))
 
 LOWFUNC(NONE,READ,3,raw_mov_l_rR,(W4 d, R4 s, IMM offset))
 {
@@ -875,35 +931,35 @@ LOWFUNC(NONE,NONE,2,raw_mov_l_rr,(W4 d, R4 s))
 }
 LENDFUNC(NONE,NONE,2,raw_mov_l_rr,(W4 d, R4 s))
 
-LOWFUNC(NONE,WRITE,2,raw_mov_l_mr,(IMM d, R4 s))
+LOWFUNC(NONE,WRITE,2,raw_mov_l_mr,(MEMW d, R4 s))
 {
 	MOVLrm(s, d, X86_NOREG, X86_NOREG, 1);
 }
-LENDFUNC(NONE,WRITE,2,raw_mov_l_mr,(IMM d, R4 s))
+LENDFUNC(NONE,WRITE,2,raw_mov_l_mr,(MEMW d, R4 s))
 
-LOWFUNC(NONE,WRITE,2,raw_mov_w_mr,(IMM d, R2 s))
+LOWFUNC(NONE,WRITE,2,raw_mov_w_mr,(MEMW d, R2 s))
 {
 	MOVWrm(s, d, X86_NOREG, X86_NOREG, 1);
 }
-LENDFUNC(NONE,WRITE,2,raw_mov_w_mr,(IMM d, R2 s))
+LENDFUNC(NONE,WRITE,2,raw_mov_w_mr,(MEMW d, R2 s))
 
-LOWFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, IMM s))
+LOWFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, MEMR s))
 {
 	MOVWmr(s, X86_NOREG, X86_NOREG, 1, d);
 }
-LENDFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, IMM s))
+LENDFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, MEMR s))
 
-LOWFUNC(NONE,WRITE,2,raw_mov_b_mr,(IMM d, R1 s))
+LOWFUNC(NONE,WRITE,2,raw_mov_b_mr,(MEMW d, R1 s))
 {
 	MOVBrm(s, d, X86_NOREG, X86_NOREG, 1);
 }
-LENDFUNC(NONE,WRITE,2,raw_mov_b_mr,(IMM d, R1 s))
+LENDFUNC(NONE,WRITE,2,raw_mov_b_mr,(MEMW d, R1 s))
 
-LOWFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, IMM s))
+LOWFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, MEMR s))
 {
 	MOVBmr(s, X86_NOREG, X86_NOREG, 1, d);
 }
-LENDFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, IMM s))
+LENDFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, MEMR s))
 
 LOWFUNC(NONE,NONE,2,raw_mov_l_ri,(W4 d, IMM s))
 {
@@ -929,23 +985,23 @@ LOWFUNC(RMW,RMW,2,raw_adc_l_mi,(MEMRW d, IMM s))
 }
 LENDFUNC(RMW,RMW,2,raw_adc_l_mi,(MEMRW d, IMM s))
 
-LOWFUNC(WRITE,RMW,2,raw_add_l_mi,(IMM d, IMM s)) 
+LOWFUNC(WRITE,RMW,2,raw_add_l_mi,(MEMRW d, IMM s)) 
 {
 	ADDLim(s, d, X86_NOREG, X86_NOREG, 1);
 }
-LENDFUNC(WRITE,RMW,2,raw_add_l_mi,(IMM d, IMM s)) 
+LENDFUNC(WRITE,RMW,2,raw_add_l_mi,(MEMRW d, IMM s)) 
 
-LOWFUNC(WRITE,RMW,2,raw_add_w_mi,(IMM d, IMM s)) 
+LOWFUNC(WRITE,RMW,2,raw_add_w_mi,(MEMRW d, IMM s)) 
 {
 	ADDWim(s, d, X86_NOREG, X86_NOREG, 1);
 }
-LENDFUNC(WRITE,RMW,2,raw_add_w_mi,(IMM d, IMM s)) 
+LENDFUNC(WRITE,RMW,2,raw_add_w_mi,(MEMRW d, IMM s)) 
 
-LOWFUNC(WRITE,RMW,2,raw_add_b_mi,(IMM d, IMM s)) 
+LOWFUNC(WRITE,RMW,2,raw_add_b_mi,(MEMRW d, IMM s)) 
 {
 	ADDBim(s, d, X86_NOREG, X86_NOREG, 1);
 }
-LENDFUNC(WRITE,RMW,2,raw_add_b_mi,(IMM d, IMM s)) 
+LENDFUNC(WRITE,RMW,2,raw_add_b_mi,(MEMRW d, IMM s)) 
 
 LOWFUNC(WRITE,NONE,2,raw_test_l_ri,(R4 d, IMM i))
 {
@@ -2153,7 +2209,7 @@ LOWFUNC(NONE,READ,5,raw_mov_b_brrm_indexed,(W1 d, IMM base, R4 baser, R4 index,
 }
 LENDFUNC(NONE,READ,5,raw_mov_b_brrm_indexed,(W1 d, IMM base, R4 baser, R4 index, IMM factor))
 
-LOWFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor))
+LOWFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor))
 {
   int fi;
   switch(factor) {
@@ -2170,9 +2226,9 @@ LOWFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor))
     emit_byte(0x05+8*index+64*fi);
     emit_long(base);
 }
-LENDFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor))
+LENDFUNC(NONE,READ,4,raw_mov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor))
 
-LOWFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor, IMM cond))
+LOWFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor, IMM cond))
 {
     int fi;
     switch(factor) {
@@ -2201,9 +2257,9 @@ LOWFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor,
 	emit_long(base);
     }
 }
-LENDFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor, IMM cond))
+LENDFUNC(NONE,READ,5,raw_cmov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor, IMM cond))
 
-LOWFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, IMM mem, IMM cond))
+LOWFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, MEMR mem, IMM cond))
 {
     if (have_cmov) {
 	emit_byte(0x0f);
@@ -2220,7 +2276,7 @@ LOWFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, IMM mem, IMM cond))
 	emit_long(mem);
     }
 }
-LENDFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, IMM mem, IMM cond))
+LENDFUNC(NONE,READ,3,raw_cmov_l_rm,(W4 d, MEMR mem, IMM cond))
 
 LOWFUNC(NONE,READ,3,raw_mov_l_rR,(W4 d, R4 s, IMM offset))
 {
@@ -2459,47 +2515,47 @@ LOWFUNC(NONE,NONE,2,raw_mov_l_rr,(W4 d, R4 s))
 }
 LENDFUNC(NONE,NONE,2,raw_mov_l_rr,(W4 d, R4 s))
 
-LOWFUNC(NONE,WRITE,2,raw_mov_l_mr,(IMM d, R4 s))
+LOWFUNC(NONE,WRITE,2,raw_mov_l_mr,(MEMW d, R4 s))
 {
     emit_byte(0x89);
     emit_byte(0x05+8*s);
     emit_long(d);
 }
-LENDFUNC(NONE,WRITE,2,raw_mov_l_mr,(IMM d, R4 s))
+LENDFUNC(NONE,WRITE,2,raw_mov_l_mr,(MEMW d, R4 s))
 
-LOWFUNC(NONE,WRITE,2,raw_mov_w_mr,(IMM d, R2 s))
+LOWFUNC(NONE,WRITE,2,raw_mov_w_mr,(MEMW d, R2 s))
 {
     emit_byte(0x66);
     emit_byte(0x89);
     emit_byte(0x05+8*s);
     emit_long(d);
 }
-LENDFUNC(NONE,WRITE,2,raw_mov_w_mr,(IMM d, R2 s))
+LENDFUNC(NONE,WRITE,2,raw_mov_w_mr,(MEMW d, R2 s))
 
-LOWFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, IMM s))
+LOWFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, MEMR s))
 {
     emit_byte(0x66);
     emit_byte(0x8b);
     emit_byte(0x05+8*d);
     emit_long(s);
 }
-LENDFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, IMM s))
+LENDFUNC(NONE,READ,2,raw_mov_w_rm,(W2 d, MEMR s))
 
-LOWFUNC(NONE,WRITE,2,raw_mov_b_mr,(IMM d, R1 s))
+LOWFUNC(NONE,WRITE,2,raw_mov_b_mr,(MEMW d, R1 s))
 {
     emit_byte(0x88);
     emit_byte(0x05+8*(s&0xf)); /* XXX this handles %ah case (defined as 0x10+4) and others */
     emit_long(d);
 }
-LENDFUNC(NONE,WRITE,2,raw_mov_b_mr,(IMM d, R1 s))
+LENDFUNC(NONE,WRITE,2,raw_mov_b_mr,(MEMW d, R1 s))
 
-LOWFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, IMM s))
+LOWFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, MEMR s))
 {
     emit_byte(0x8a);
     emit_byte(0x05+8*d);
     emit_long(s);
 }
-LENDFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, IMM s))
+LENDFUNC(NONE,READ,2,raw_mov_b_rm,(W1 d, MEMR s))
 
 LOWFUNC(NONE,NONE,2,raw_mov_l_ri,(W4 d, IMM s))
 {
@@ -2532,7 +2588,7 @@ LOWFUNC(RMW,RMW,2,raw_adc_l_mi,(MEMRW d, IMM s))
 }
 LENDFUNC(RMW,RMW,2,raw_adc_l_mi,(MEMRW d, IMM s))
 
-LOWFUNC(WRITE,RMW,2,raw_add_l_mi,(IMM d, IMM s)) 
+LOWFUNC(WRITE,RMW,2,raw_add_l_mi,(MEMRW d, IMM s)) 
 {
 	if (optimize_imm8 && isbyte(s)) {
     emit_byte(0x83);
@@ -2547,9 +2603,9 @@ LOWFUNC(WRITE,RMW,2,raw_add_l_mi,(IMM d, IMM s))
     emit_long(s);
 	}
 }
-LENDFUNC(WRITE,RMW,2,raw_add_l_mi,(IMM d, IMM s)) 
+LENDFUNC(WRITE,RMW,2,raw_add_l_mi,(MEMRW d, IMM s)) 
 
-LOWFUNC(WRITE,RMW,2,raw_add_w_mi,(IMM d, IMM s)) 
+LOWFUNC(WRITE,RMW,2,raw_add_w_mi,(MEMRW d, IMM s)) 
 {
     emit_byte(0x66);
     emit_byte(0x81);
@@ -2557,16 +2613,16 @@ LOWFUNC(WRITE,RMW,2,raw_add_w_mi,(IMM d, IMM s))
     emit_long(d);
     emit_word(s);
 }
-LENDFUNC(WRITE,RMW,2,raw_add_w_mi,(IMM d, IMM s)) 
+LENDFUNC(WRITE,RMW,2,raw_add_w_mi,(MEMRW d, IMM s)) 
 
-LOWFUNC(WRITE,RMW,2,raw_add_b_mi,(IMM d, IMM s)) 
+LOWFUNC(WRITE,RMW,2,raw_add_b_mi,(MEMRW d, IMM s)) 
 {
     emit_byte(0x80);
     emit_byte(0x05);
     emit_long(d);
     emit_byte(s);
 }
-LENDFUNC(WRITE,RMW,2,raw_add_b_mi,(IMM d, IMM s)) 
+LENDFUNC(WRITE,RMW,2,raw_add_b_mi,(MEMRW d, IMM s)) 
 
 LOWFUNC(WRITE,NONE,2,raw_test_l_ri,(R4 d, IMM i))
 {
@@ -3072,7 +3128,7 @@ static __inline__ void raw_call_r(R4 r)
 #endif
 }
 
-static __inline__ void raw_call_m_indexed(uae_u32 base, uae_u32 r, uae_u32 m)
+static __inline__ void raw_call_m_indexed(uintptr base, uae_u32 r, uae_u32 m)
 {
 #if USE_NEW_RTASM
     CALLsm(base, X86_NOREG, r, m);
@@ -3102,7 +3158,7 @@ static __inline__ void raw_jmp_r(R4 r)
 #endif
 }
 
-static __inline__ void raw_jmp_m_indexed(uae_u32 base, uae_u32 r, uae_u32 m)
+static __inline__ void raw_jmp_m_indexed(uintptr base, uae_u32 r, uae_u32 m)
 {
 #if USE_NEW_RTASM
     JMPsm(base, X86_NOREG, r, m);
@@ -3130,9 +3186,40 @@ static __inline__ void raw_jmp_m(uae_u32 base)
 }
 
 
-static __inline__ void raw_call(uae_u32 t)
+#if defined(__x86_64__)
+/* Whether a rel32 branch of LEN bytes emitted at the current target can
+   reach T. Otherwise, an indirect branch through a 64-bit literal is used */
+static __inline__ bool raw_rel32_reachable(uintptr t, int len)
+{
+    intptr d = (intptr)t - ((intptr)target + len);
+    return d == (intptr)(uae_s32)d;
+}
+
+/* jmp *0(%rip); .quad t */
+static __inline__ void raw_jmp_far(uintptr t)
+{
+    emit_byte(0xff);
+    emit_byte(0x25);
+    emit_long(0);
+    emit_quad(t);
+}
+#endif
+
+static __inline__ void raw_call(uintptr t)
 {
 #if USE_NEW_RTASM
+#if defined(__x86_64__)
+    if (!raw_rel32_reachable(t, 5)) {
+	/* call *2(%rip); jmp 1f; .quad t; 1: */
+	emit_byte(0xff);
+	emit_byte(0x15);
+	emit_long(2);
+	emit_byte(0xeb);
+	emit_byte(0x08);
+	emit_quad(t);
+	return;
+    }
+#endif
     CALLm(t);
 #else
     emit_byte(0xe8);
@@ -3140,9 +3227,15 @@ static __inline__ void raw_call(uae_u32 t)
 #endif
 }
 
-static __inline__ void raw_jmp(uae_u32 t)
+static __inline__ void raw_jmp(uintptr t)
 {
 #if USE_NEW_RTASM
+#if defined(__x86_64__)
+    if (!raw_rel32_reachable(t, 5)) {
+	raw_jmp_far(t);
+	return;
+    }
+#endif
     JMPm(t);
 #else
     emit_byte(0xe9);
@@ -3150,22 +3243,49 @@ static __inline__ void raw_jmp(uae_u32 t)
 #endif
 }
 
-static __inline__ void raw_jl(uae_u32 t)
+static __inline__ void raw_jl(uintptr t)
 {
+#if defined(__x86_64__)
+    if (!raw_rel32_reachable(t, 6)) {
+	/* Branch around a far jump on the inverted condition */
+	emit_byte(0x7d); /* jge */
+	emit_byte(14);
+	raw_jmp_far(t);
+	return;
+    }
+#endif
     emit_byte(0x0f);
     emit_byte(0x8c);
     emit_long(t-(uintptr)target-4);
 }
 
-static __inline__ void raw_jz(uae_u32 t)
+static __inline__ void raw_jz(uintptr t)
 {
+#if defined(__x86_64__)
+    if (!raw_rel32_reachable(t, 6)) {
+	/* Branch around a far jump on the inverted condition */
+	emit_byte(0x75); /* jnz */
+	emit_byte(14);
+	raw_jmp_far(t);
+	return;
+    }
+#endif
     emit_byte(0x0f);
     emit_byte(0x84);
     emit_long(t-(uintptr)target-4);
 }
 
-static __inline__ void raw_jnz(uae_u32 t)
+static __inline__ void raw_jnz(uintptr t)
 {
+#if defined(__x86_64__)
+    if (!raw_rel32_reachable(t, 6)) {
+	/* Branch around a far jump on the inverted condition */
+	emit_byte(0x74); /* jz */
+	emit_byte(14);
+	raw_jmp_far(t);
+	return;
+    }
+#endif
     emit_byte(0x0f);
     emit_byte(0x85);
     emit_long(t-(uintptr)target-4);
@@ -3844,12 +3964,17 @@ static void
 cpuid(uae_u32 op, uae_u32 *eax, uae_u32 *ebx, uae_u32 *ecx, uae_u32 *edx)
 {
   const int CPUID_SPACE = 4096;
-  uae_u8* cpuid_space = (uae_u8 *)vm_acquire(CPUID_SPACE);
+  static uae_u32 s_op, s_eax, s_ebx, s_ecx, s_edx;
+
+  /* The stub addresses the variables above with 32-bit displacements, so
+     it has to be near them when the program is position-independent */
+  uae_u8* cpuid_space = (uae_u8 *)vm_acquire_near(&s_op, CPUID_SPACE, 0x40000000);
+  if (cpuid_space == VM_MAP_FAILED)
+    cpuid_space = (uae_u8 *)vm_acquire(CPUID_SPACE, VM_MAP_DEFAULT | VM_MAP_32BIT);
   if (cpuid_space == VM_MAP_FAILED)
     abort();
   vm_protect(cpuid_space, CPUID_SPACE, VM_PAGE_READ | VM_PAGE_WRITE | VM_PAGE_EXECUTE);
 
-  static uae_u32 s_op, s_eax, s_ebx, s_ecx, s_edx;
   uae_u8* tmp=get_target();
 
   s_op = op;
@@ -4171,7 +4296,7 @@ static __inline__ void tos_make(int r)
 /* FP helper functions */
 #if USE_NEW_RTASM
 #define DEFINE_OP(NAME, GEN)			\
-static inline void raw_##NAME(uint32 m)		\
+static inline void raw_##NAME(uintptr m)		\
 {						\
     GEN(m, X86_NOREG, X86_NOREG, 1);		\
 }
@@ -4356,13 +4481,36 @@ LOWFUNC(NONE,NONE,2,raw_fmov_rr,(FW d, FR s))
 }
 LENDFUNC(NONE,NONE,2,raw_fmov_rr,(FW d, FR s))
 
-LOWFUNC(NONE,READ,4,raw_fldcw_m_indexed,(R4 index, IMM base))
+LOWFUNC(NONE,READ,4,raw_fldcw_m_indexed,(R4 index, MEMR base))
 {
+#if defined(__x86_64__)
+    if ((intptr)base != (intptr)(uae_s32)base) {
+	/* Table out of reach of a 32-bit displacement: fldcw (tmp,index) */
+	int tmp = (index == EAX_INDEX) ? ECX_INDEX : EAX_INDEX;
+	raw_push_l_r(tmp);
+	MOVQir(base, tmp);
+	if (index >= 8)
+	    emit_byte(0x42);
+	emit_byte(0xd9);
+	emit_byte(0x2c);
+	emit_byte(((index & 7) << 3) | tmp);
+	raw_pop_l_r(tmp);
+	return;
+    }
+    /* fldcw base(,index) */
+    if (index >= 8)
+	emit_byte(0x42);
+    emit_byte(0xd9);
+    emit_byte(0x2c);
+    emit_byte(((index & 7) << 3) | 5);
+    emit_long(base);
+#else
     emit_byte(0xd9);
     emit_byte(0xa8+index);
     emit_long(base);
+#endif
 }
-LENDFUNC(NONE,READ,4,raw_fldcw_m_indexed,(R4 index, IMM base))
+LENDFUNC(NONE,READ,4,raw_fldcw_m_indexed,(R4 index, MEMR base))
 
 
 LOWFUNC(NONE,NONE,2,raw_fsqrt_rr,(FW d, FR s))
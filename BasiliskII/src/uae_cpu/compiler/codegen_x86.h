@@ -423,18 +423,22 @@ typedef unsigned int	_ul;
 #define _r_DB(  R, D,B    )	((_s0P(D) && (!_rbp13P(B)) ? _r_0B  (R,  B    ) : (_s8P(D) ? _r_1B(  R,D,B    ) : _r_4B(  R,D,B    ))))
 #define _r_DBIS(R, D,B,I,S)	((_s0P(D) && (!_rbp13P(B)) ? _r_0BIS(R,  B,I,S) : (_s8P(D) ? _r_1BIS(R,D,B,I,S) : _r_4BIS(R,D,B,I,S))))
 
+/* Absolute addresses are sign-extended from 32 bits in 64-bit mode */
+#define _x86_abs32P(D)	((intptr)(D) == (intptr)(int)(D))
+#define _x86_abs32(D)	(!X86_TARGET_64BIT || _x86_abs32P(D) ? (D) : x86_emit_failure0("absolute address out of 32-bit range"))
+
 /* Use RIP-addressing in 64-bit mode, if possible */
 #define _x86_RIP_addressing_possible(D,O)	(X86_RIP_RELATIVE_ADDR && \
-						((uintptr)x86_get_target() + 4 + (O) - (D) <= 0xffffffff))
+						_x86_abs32P((intptr)(D) - ((intptr)x86_get_target() + 4 + (O))))
 
 #define _r_X(   R, D,B,I,S,O)	(_r0P(I) ? (_r0P(B)    ? (!X86_TARGET_64BIT ? _r_D(R,D) : \
 					                 (_x86_RIP_addressing_possible(D, O) ? \
 				                          _r_D(R, (D) - ((uintptr)x86_get_target() + 4 + (O))) : \
-				                          _r_DSIB(R,D))) : \
+				                          _r_DSIB(R,_x86_abs32(D)))) : \
 				           (_rIP(B)    ? _r_D   (R,D                )   : \
 				           (_rsp12P(B) ? _r_DBIS(R,D,_rSP(),_rSP(),1)   : \
 						         _r_DB  (R,D,     B       ))))  : \
-				 (_r0P(B)	       ? _r_4IS (R,D,	         I,S)   : \
+				 (_r0P(B)	       ? _r_4IS (R,_x86_abs32(D), I,S)   : \
 				 (!_rspP(I)            ? _r_DBIS(R,D,     B,     I,S)   : \
 						         x86_emit_failure("illegal index register: %esp"))))
 
@@ -1259,19 +1263,19 @@ enum {
 /*									_format		Opcd		,Mod ,r	    ,m		,mem=dsp+sib	,imm... */
 
 // FIXME: no prefix is availble to encode a 32-bit operand size in 64-bit mode
-#define CALLm(M)							_O_D32		(0xe8					,(int)(M)		)
+#define CALLm(M)							_O_D32		(0xe8					,(uintptr)(M)		)
 #define _CALLLsr(R)			(_REXLrr(0, R),			_O_Mrm		(0xff		,_b11,_b010,_r4(R)				))
 #define _CALLQsr(R)			(_REXLrr(0, R),			_O_Mrm		(0xff		,_b11,_b010,_r8(R)				))
 #define CALLsr(R)			( X86_TARGET_64BIT ? _CALLQsr(R) : _CALLLsr(R))
-#define CALLsm(D,B,I,S)			(_REXLrm(0, B, I),		_O_r_X		(0xff		     ,_b010		,(int)(D),B,I,S		))
+#define CALLsm(D,B,I,S)			(_REXLrm(0, B, I),		_O_r_X		(0xff		     ,_b010		,(uintptr)(D),B,I,S		))
 
 // FIXME: no prefix is availble to encode a 32-bit operand size in 64-bit mode
 #define JMPSm(M)							_O_D8		(0xeb					,(int)(M)		)
-#define JMPm(M)								_O_D32		(0xe9					,(int)(M)		)
+#define JMPm(M)								_O_D32		(0xe9					,(uintptr)(M)		)
 #define _JMPLsr(R)			(_REXLrr(0, R),			_O_Mrm		(0xff		,_b11,_b100,_r4(R)				))
 #define _JMPQsr(R)			(_REXLrr(0, R),			_O_Mrm		(0xff		,_b11,_b100,_r8(R)				))
 #define JMPsr(R)			( X86_TARGET_64BIT ? _JMPQsr(R) : _JMPLsr(R))
-#define JMPsm(D,B,I,S)			(_REXLrm(0, B, I),		_O_r_X		(0xff		     ,_b100		,(int)(D),B,I,S		))
+#define JMPsm(D,B,I,S)			(_REXLrm(0, B, I),		_O_r_X		(0xff		     ,_b100		,(uintptr)(D),B,I,S		))
 
 /*									_format		Opcd		,Mod ,r	    ,m		,mem=dsp+sib	,imm... */
 #define JCCSii(CC, D)							_O_B		(0x70|(CC)				,(_sc)(int)(D)		)
@@ -1307,7 +1311,7 @@ enum {
 
 /*									_format		Opcd		,Mod ,r	    ,m		,mem=dsp+sib	,imm... */
 #define JCCii(CC, D)							_OO_L		(0x0f80|(CC)				,(int)(D)		)
-#define JCCim(CC, D)							_OO_D32		(0x0f80|(CC)				,(int)(D)		)
+#define JCCim(CC, D)							_OO_D32		(0x0f80|(CC)				,(uintptr)(D)		)
 #define JOm(D)				JCCim(X86_CC_O,   D)
 #define JNOm(D)				JCCim(X86_CC_NO,  D)
 #define JBm(D)				JCCim(X86_CC_B,   D)
@@ -35,10 +35,12 @@
 #error "Only [LS]AHF scheme to [gs]et flags is supported with the JIT Compiler"
 #endif
 
-/* NOTE: support for AMD64 assumes translation cache and other code
- * buffers are allocated into a 32-bit address space because (i) B2/JIT
- * code is not 64-bit clean and (ii) it's faster to resolve branches
- * that way.
+/* NOTE: on AMD64, the translation cache and other code buffers are
+ * allocated close to the program image so that branches and data
+ * references resolve with 32-bit displacements (RIP-relative for the
+ * latter). Host pointers are otherwise handled as 64-bit quantities, so
+ * the cache may as well live anywhere. Emulated memory still has to be
+ * in the low 4 GB because guest accesses use 32-bit address arithmetic.
  */
 #if !defined(__i386__) && !defined(__x86_64__)
 #error "Only IA-32 and X86-64 targets are supported with the JIT Compiler"
@@ -46,6 +48,9 @@
 
 #define USE_MATCH 0
 
+/* Keep the most used 68k registers of a block in fixed native registers */
+#define USE_PINNED_REGS 1
+
 /* kludge for Brian, so he can compile under MSVC++ */
 #define USE_NORMAL_CALLING_CONVENTION 1 && defined(_MSC_VER)
 
@@ -56,6 +61,7 @@
 #endif
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <fcntl.h>
 #include <errno.h>
 
@@ -81,13 +87,17 @@
 #include "mon.h"
 #endif
 
-#define PROFILE_COMPILE_TIME		0
-#define PROFILE_UNTRANSLATED_INSNS	0
-
 #if defined(__x86_64__) && 0
 #define RECORD_REGISTER_USAGE		1
 #endif
 
+#if defined(HAVE_PTHREADS)
+#define USE_COMPILE_THREAD			1
+#include <pthread.h>
+#else
+#define USE_COMPILE_THREAD			0
+#endif
+
 //#ifdef WIN32
 #undef write_log
 #define write_log dummy_write_log
@@ -114,15 +124,20 @@ static int reg_count_compare(const void *ap, const void *bp)
 }
 #endif
 
-#if PROFILE_COMPILE_TIME
+// Profiling, enabled with the "jitprofile" pref
 #include <time.h>
 static uae_u32 compile_count	= 0;
+static uae_u32 untranslated_fpu_count = 0;	// FPU instructions translated as calls to the interpreter
 static clock_t compile_time		= 0;
 static clock_t emul_start_time	= 0;
-static clock_t emul_end_time	= 0;
-#endif
+static time_t last_profile_report = 0;
+const int profile_report_interval = 10;		// Seconds between reports while running
+static FILE *perf_map			= NULL;		// /tmp/perf-<pid>.map, read by perf to name JIT code
+
+// Translations of ROM code kept across runs, enabled with the "jitromcache" pref
+static const char *rom_cache_path = NULL;
+static void rom_cache_save(void);
 
-#if PROFILE_UNTRANSLATED_INSNS
 const int untranslated_top_ten = 20;
 static uae_u32 raw_cputbl_count[65536] = { 0, };
 static uae_u16 opcode_nums[65536];
@@ -131,7 +146,6 @@ static int untranslated_compfn(const void *e1, const void *e2)
 {
 	return raw_cputbl_count[*(const uae_u16 *)e1] < raw_cputbl_count[*(const uae_u16 *)e2];
 }
-#endif
 
 static compop_func *compfunctbl[65536];
 static compop_func *nfcompfunctbl[65536];
@@ -157,6 +171,17 @@ const uae_u32	MIN_CACHE_SIZE		= 1024;		// Minimal translation cache size (1 MB)
 static uae_u32	cache_size			= 0;		// Size of total cache allocated for compiled blocks
 static uae_u32	current_cache_size	= 0;		// Cache grows upwards: how much has been consumed already
 static bool		lazy_flush			= true;		// Flag: lazy translation cache invalidation
+static bool		predict_branches	= false;	// Flag: go straight to predicted targets of indirect jumps and returns
+static bool		jit_profile			= false;	// Flag: count block executions and untranslated insns, write perf map
+#if USE_CHECKSUM_INFO
+static bool		smc_protect			= false;	// Flag: write-protect RAM pages holding translated code
+#else
+const bool		smc_protect			= false;
+#endif
+#if USE_COMPILE_THREAD
+static bool		compile_thread_active = false;	// Flag: translate hot blocks in a separate thread
+static bool		compiling_in_thread	= false;	// Running in the compile thread?
+#endif
 static bool		avoid_fpu			= true;		// Flag: compile FPU instructions ?
 static bool		have_cmov			= false;	// target has CMOV instructions ?
 static bool		have_lahf_lm		= true;		// target has LAHF supported in long mode ?
@@ -170,14 +195,20 @@ static int		optcount[10]		= {
 	10,		// How often a block has to be executed before it is translated
 	0,		// How often to use naive translation
 	0, 0, 0, 0,
-	-1, -1, -1, -1
+	-1,		// How often to use block translation before tracing (-1: never)
+	-1, -1, -1
 };
+const int		TRACE_OPTLEVEL		= 7;		// Optimization level of traces
+const int		TRACE_THRESHOLD		= 500;		// Default executions before a block becomes a trace
+const int		MAX_TRACE_BRANCHES	= 8;		// Conditional branches a trace can follow
+const int		MIN_TRACE_LOOP		= 32;		// Unroll loops to at least that many instructions
 
 struct op_properties {
 	uae_u8 use_flags;
 	uae_u8 set_flags;
 	uae_u8 is_addx;
 	uae_u8 cflow;
+	uae_u8 is_cond_branch;	// Registers both outcomes, can be followed by a trace
 };
 static op_properties prop[65536];
 
@@ -196,6 +227,11 @@ static inline bool may_trap(uae_u32 opcode)
 	return (prop[opcode].cflow & fl_trap) != 0;
 }
 
+static inline bool trace_through(uae_u32 opcode)
+{
+	return prop[opcode].is_cond_branch && compfunctbl[opcode] && nfcompfunctbl[opcode];
+}
+
 static inline unsigned int cft_map (unsigned int f)
 {
 #ifndef HAVE_GET_WORD_UNSWAPPED
@@ -218,10 +254,21 @@ static int redo_current_block;
 int segvcount=0;
 int soft_flush_count=0;
 int hard_flush_count=0;
+int segment_flush_count=0;
 int checksum_count=0;
+int smc_fault_count=0;
+int smc_guarded_count=0;
 static uae_u8* current_compile_p=NULL;
 static uae_u8* max_compile_start;
 static uae_u8* compiled_code=NULL;
+const int CACHE_SEGMENTS = 8;			/* The translation cache is a ring of segments */
+const uae_u32 MIN_SEGMENT_SIZE = 16 * BYTES_PER_INST;
+static int cache_segments = 1;			/* Number of segments actually in use */
+static uae_u32 segment_size = 0;		/* Size of a segment in bytes */
+static int current_segment = 0;			/* Segment being filled */
+static uae_u32 segment_evict_count[CACHE_SEGMENTS];	/* Number of times a segment was reclaimed */
+static uae_u32 evicted_block_count = 0;
+static uae_u32 survived_block_count = 0;
 static uae_s32 reg_alloc_run;
 const int POPALLSPACE_SIZE = 1024; /* That should be enough space */
 static uae_u8* popallspace=NULL;
@@ -266,8 +313,15 @@ extern struct cputbl op_smalltbl_4_nf[];
 extern struct cputbl op_smalltbl_5_nf[];
 
 static void flush_icache_hard(int n);
+static void flush_icache_segment(int n);
 static void flush_icache_lazy(int n);
 static void flush_icache_none(int n);
+static void flush_block(blockinfo *bi);
+#if USE_COMPILE_THREAD
+static bool compile_thread_init(void);
+static void compile_thread_exit(void);
+static void compile_thread_wait(void);
+#endif
 void (*flush_icache)(int n) = flush_icache_none;
 
 
@@ -543,6 +597,37 @@ static __inline__ void mark_callers_recompile(blockinfo * bi)
   }
 }
 
+/* Blocks that left flags out of date on their way to bi, as bi would not
+   read them, must not run while bi may have changed. They are checked
+   again along with bi, or translated again if bi did change */
+static void flush_flag_callers(blockinfo* bi, int changed)
+{
+    dependency* x=bi->deplist;
+
+    while (x) {
+	blockinfo* cbi=x->source;
+
+	x=x->next;
+	if (cbi->flagdeps!=1)
+	    continue;
+	if (cbi->status==BI_ACTIVE && lazy_flush && !changed) {
+	    uae_u32 cl=cacheline(cbi->pc_p);
+
+	    if (cbi==cache_tags[cl+1].bi)
+		cache_tags[cl].handler=(cpuop_func *)popall_check_checksum;
+	    cbi->handler_to_use=(cpuop_func *)popall_check_checksum;
+	    set_dhtu(cbi,cbi->direct_pcc);
+	    cbi->status=BI_NEED_CHECK;
+	}
+	else if (cbi->status==BI_ACTIVE ||
+		 (changed && cbi->status==BI_NEED_CHECK))
+	    block_need_recompile(cbi);
+	else
+	    continue;
+	flush_flag_callers(cbi,changed);
+    }
+}
+
 static __inline__ blockinfo* get_blockinfo_addr_new(void* addr, int setstate)
 {
     blockinfo*  bi=get_blockinfo_addr(addr);
@@ -659,9 +744,15 @@ public:
 #if USE_SEPARATE_BIA
 static LazyBlockAllocator<blockinfo> BlockInfoAllocator;
 static LazyBlockAllocator<checksum_info> ChecksumInfoAllocator;
+#if USE_CHECKSUM_INFO
+static LazyBlockAllocator<range_link> RangeLinkAllocator;
+#endif
 #else
 static HardBlockAllocator<blockinfo> BlockInfoAllocator;
 static HardBlockAllocator<checksum_info> ChecksumInfoAllocator;
+#if USE_CHECKSUM_INFO
+static HardBlockAllocator<range_link> RangeLinkAllocator;
+#endif
 #endif
 
 static __inline__ checksum_info *alloc_checksum_info(void)
@@ -686,18 +777,188 @@ static __inline__ void free_checksum_info_chain(checksum_info *csi)
 	}
 }
 
+#if USE_CHECKSUM_INFO
+/* Index of the blocks by the pages of 68k code they were translated from.
+   Buckets are hashed by page number, so a bucket can hold blocks from
+   unrelated pages: users must check the actual checksum_info ranges. */
+static range_link *range_index[RANGE_INDEX_SIZE];
+
+static void index_block_ranges(blockinfo *bi)
+{
+	for (checksum_info *csi = bi->csi; csi; csi = csi->next) {
+		uintptr first = (uintptr)csi->start_p >> RANGE_PAGE_SHIFT;
+		uintptr last = ((uintptr)csi->start_p + csi->length - 1) >> RANGE_PAGE_SHIFT;
+		if (last - first >= RANGE_INDEX_SIZE)
+			last = first + RANGE_INDEX_SIZE - 1;
+		for (uintptr page = first; page <= last; page++) {
+			uae_u32 bucket = page & (RANGE_INDEX_SIZE - 1);
+			range_link *rl;
+			for (rl = bi->ranges; rl; rl = rl->next_of_block) {
+				if (rl->bucket == bucket)
+					break;
+			}
+			if (rl)
+				continue;
+			rl = RangeLinkAllocator.acquire();
+			rl->bi = bi;
+			rl->bucket = bucket;
+			rl->next = range_index[bucket];
+			if (rl->next)
+				rl->next->prev_p = &(rl->next);
+			rl->prev_p = &(range_index[bucket]);
+			range_index[bucket] = rl;
+			rl->next_of_block = bi->ranges;
+			bi->ranges = rl;
+		}
+	}
+}
+
+static void unindex_block_ranges(blockinfo *bi)
+{
+	range_link *rl = bi->ranges;
+	while (rl) {
+		range_link *next = rl->next_of_block;
+		*(rl->prev_p) = rl->next;
+		if (rl->next)
+			rl->next->prev_p = rl->prev_p;
+		RangeLinkAllocator.release(rl);
+		rl = next;
+	}
+	bi->ranges = NULL;
+}
+
+/* Write-protection of the RAM pages translated code comes from. While a
+   page is read-only, the active blocks translated from it are known to
+   match memory and flushes can leave them alone. A write faults, and the
+   page is queued for invalidation at the next safe point of the compiled
+   code loop: the fault may come from another thread, and the caller may
+   be in the middle of a block. */
+enum {
+	SMC_PAGE_CLEAN,			// Writable, no translation depends on it
+	SMC_PAGE_PROTECTED,		// Read-only, translations match memory
+	SMC_PAGE_WRITTEN,		// Written since protected, blocks not flushed yet
+	SMC_PAGE_UNGUARDED		// Faulted too often, left to checksums
+};
+
+const int SMC_MAX_FAULTS = 16;			// Faults before a page is no longer protected
+const int SMC_GROUP_SHIFT = 6;			// Pages per written group (log2)
+
+struct smc_page_info {
+	volatile uae_u8 state;
+	uae_u8 faults;
+};
+
+static smc_page_info *smc_pages = NULL;
+static volatile uae_u8 *smc_written_groups = NULL;
+static volatile bool smc_pages_written = false;
+static uae_u32 smc_page_count = 0;
+static uae_u32 smc_page_size = 0;
+static int smc_page_shift = 0;
+
+static __inline__ smc_page_info *smc_page_of(uintptr addr)
+{
+	const uintptr offset = addr - (uintptr)RAMBaseHost;
+	if (offset >= RAMSize)
+		return NULL;
+	return &smc_pages[offset >> smc_page_shift];
+}
+
+static __inline__ uae_u8 *smc_page_address(smc_page_info *info)
+{
+	return RAMBaseHost + ((uintptr)(info - smc_pages) << smc_page_shift);
+}
+
+static bool smc_init(void)
+{
+	smc_page_size = vm_get_page_size();
+	for (smc_page_shift = 0; (1U << smc_page_shift) < smc_page_size; smc_page_shift++)
+		;
+	smc_page_count = (RAMSize + smc_page_size - 1) >> smc_page_shift;
+	smc_pages = (smc_page_info *)calloc(smc_page_count, sizeof(smc_page_info));
+	smc_written_groups = (uae_u8 *)calloc((smc_page_count >> SMC_GROUP_SHIFT) + 1, 1);
+	return smc_pages != NULL && smc_written_groups != NULL;
+}
+
+static void smc_exit(void)
+{
+	if (smc_pages) {
+		for (uae_u32 i = 0; i < smc_page_count; i++) {
+			if (smc_pages[i].state != SMC_PAGE_CLEAN && smc_pages[i].state != SMC_PAGE_UNGUARDED)
+				vm_protect(smc_page_address(&smc_pages[i]), smc_page_size, VM_PAGE_DEFAULT);
+		}
+		free(smc_pages);
+		smc_pages = NULL;
+	}
+	if (smc_written_groups) {
+		free((void *)smc_written_groups);
+		smc_written_groups = NULL;
+	}
+}
+
+static void smc_protect_block(blockinfo *bi)
+{
+	for (checksum_info *csi = bi->csi; csi; csi = csi->next) {
+		const uintptr end = (uintptr)csi->start_p + csi->length;
+		for (uintptr p = (uintptr)csi->start_p; p < end; p = (p | (smc_page_size - 1)) + 1) {
+			smc_page_info *info = smc_page_of(p);
+			if (info == NULL || info->state != SMC_PAGE_CLEAN)
+				continue;
+			// Publish the state first, a write may fault as soon as the page is protected
+			info->state = SMC_PAGE_PROTECTED;
+			if (vm_protect(smc_page_address(info), smc_page_size, VM_PAGE_READ) != 0)
+				info->state = SMC_PAGE_CLEAN;
+		}
+	}
+}
+
+static bool smc_block_guarded(blockinfo *bi)
+{
+	for (checksum_info *csi = bi->csi; csi; csi = csi->next) {
+		const uintptr end = (uintptr)csi->start_p + csi->length;
+		for (uintptr p = (uintptr)csi->start_p; p < end; p = (p | (smc_page_size - 1)) + 1) {
+			smc_page_info *info = smc_page_of(p);
+			if (info == NULL || info->state != SMC_PAGE_PROTECTED)
+				return false;
+		}
+	}
+	// A null checksum marks a translation that may not match memory
+	return bi->csi != NULL && (bi->c1 || bi->c2);
+}
+
+/* Make a page writable again. May be called from a signal handler or from
+   any thread, so it only records the write for smc_flush_written_pages() */
+static bool smc_unprotect_page(smc_page_info *info)
+{
+	const uae_u8 state = info->state;
+	if (state != SMC_PAGE_PROTECTED && state != SMC_PAGE_WRITTEN)
+		return false;
+	if (vm_protect(smc_page_address(info), smc_page_size, VM_PAGE_DEFAULT) != 0)
+		return false;
+	info->state = SMC_PAGE_WRITTEN;
+	smc_written_groups[(info - smc_pages) >> SMC_GROUP_SHIFT] = 1;
+	smc_pages_written = true;
+	SPCFLAGS_SET( SPCFLAG_JIT_EXEC_RETURN ); /* To get out of compiled code */
+	return true;
+}
+#endif
+
 static __inline__ blockinfo *alloc_blockinfo(void)
 {
 	blockinfo *bi = BlockInfoAllocator.acquire();
+	bi->rom_trace = NULL;
 #if USE_CHECKSUM_INFO
 	bi->csi = NULL;
+	bi->ranges = NULL;
 #endif
 	return bi;
 }
 
 static __inline__ void free_blockinfo(blockinfo *bi)
 {
+    free(bi->rom_trace);
+    bi->rom_trace = NULL;
 #if USE_CHECKSUM_INFO
+	unindex_block_ranges(bi);
 	free_checksum_info_chain(bi->csi);
 	bi->csi = NULL;
 #endif
@@ -862,9 +1123,7 @@ struct regusage {
 
 static inline void ru_set(uae_u16 *mask, int reg)
 {
-#if USE_OPTIMIZED_CALLS
 	*mask |= 1 << reg;
-#endif
 }
 
 static inline bool ru_get(const uae_u16 *mask, int reg)
@@ -1079,10 +1338,38 @@ static void ru_fill(regusage *ru, uae_u32 opcode)
 		ru->wmask = 0xffff;
 	}
 
+	/* No operand information: assume all registers are used */
 	if (!handled) {
-		write_log("ru_fill: %04x = { %04x, %04x }\n",
-				  real_opcode, ru->rmask, ru->wmask);
-		abort();
+		ru->rmask = 0xffff;
+		ru->wmask = 0xffff;
+	}
+}
+
+/********************************************************************
+ * Pinned registers                                                 *
+ ********************************************************************/
+
+/* Before a block is translated, a linear scan over the live ranges of
+   the 68k registers (as found by ru_fill()) gives the most used ones a
+   home in pinned_regs[]. The allocator prefers that home and keeps other
+   values out of it while the range lasts. */
+
+static uae_s8 ra_home[16];		/* Pinned native register, -1 if none */
+static uae_s16 ra_start[16];	/* First and last instruction using the register */
+static uae_s16 ra_end[16];
+static uae_s8 ra_owner[N_REGS];	/* 68k register at home at the current instruction */
+
+#define RA_MIN_USES 2			/* Fewer uses don't save a load */
+
+static void ra_set_pos(int pos)
+{
+	int i;
+
+	for (i = 0; i < N_REGS; i++)
+		ra_owner[i] = -1;
+	for (i = 0; i < 16; i++) {
+		if (ra_home[i] >= 0 && ra_start[i] <= pos && pos <= ra_end[i])
+			ra_owner[ra_home[i]] = i;
 	}
 }
 
@@ -1407,11 +1694,24 @@ static  int alloc_reg_hinted(int r, int size, int willclobber, int hint)
     bestreg=-1;
     when=2000000000;
 
+#if USE_PINNED_REGS
+    if (hint<0 && r<16)
+	hint=ra_home[r];
+#endif
+
     /* XXX use a regalloc_order table? */
     for (i=0;i<N_REGS;i++) {
+	int reserved=0;
 	badness=live.nat[i].touched;
 	if (live.nat[i].nholds==0)
 	    badness=0;
+#if USE_PINNED_REGS
+	if (ra_owner[i]>=0 && ra_owner[i]!=r) {
+	    /* Home of another 68k register, only if nothing else is left */
+	    reserved=1;
+	    badness+=100000000;
+	}
+#endif
 	if (i==hint)  
 	    badness-=200000000;
 	if (!live.nat[i].locked && badness<when) {
@@ -1420,7 +1720,7 @@ static  int alloc_reg_hinted(int r, int size, int willclobber, int hint)
 		(size==4)) {
 		bestreg=i;
 		when=badness;
-		if (live.nat[i].nholds==0 && hint<0)
+		if (live.nat[i].nholds==0 && hint<0 && !reserved)
 		    break;
 		if (i==hint)
 		    break;
@@ -2428,14 +2728,14 @@ MIDFUNC(2,bts_l_rr,(RW4 r, R4 b))
 }
 MENDFUNC(2,bts_l_rr,(RW4 r, R4 b)) 
 
-MIDFUNC(2,mov_l_rm,(W4 d, IMM s))
+MIDFUNC(2,mov_l_rm,(W4 d, MEMR s))
 {
     CLOBBER_MOV;
     d=writereg(d,4);
     raw_mov_l_rm(d,s);
     unlock2(d);
 }
-MENDFUNC(2,mov_l_rm,(W4 d, IMM s))
+MENDFUNC(2,mov_l_rm,(W4 d, MEMR s))
 
 
 MIDFUNC(1,call_r,(R4 r)) /* Clobbering is implicit */
@@ -2446,33 +2746,33 @@ MIDFUNC(1,call_r,(R4 r)) /* Clobbering is implicit */
 }
 MENDFUNC(1,call_r,(R4 r)) /* Clobbering is implicit */
 
-MIDFUNC(2,sub_l_mi,(IMM d, IMM s)) 
+MIDFUNC(2,sub_l_mi,(MEMRW d, IMM s)) 
 {
     CLOBBER_SUB;
     raw_sub_l_mi(d,s) ;
 }
-MENDFUNC(2,sub_l_mi,(IMM d, IMM s)) 
+MENDFUNC(2,sub_l_mi,(MEMRW d, IMM s)) 
 
-MIDFUNC(2,mov_l_mi,(IMM d, IMM s)) 
+MIDFUNC(2,mov_l_mi,(MEMW d, IMM s)) 
 {
     CLOBBER_MOV;
     raw_mov_l_mi(d,s) ;
 }
-MENDFUNC(2,mov_l_mi,(IMM d, IMM s)) 
+MENDFUNC(2,mov_l_mi,(MEMW d, IMM s)) 
 
-MIDFUNC(2,mov_w_mi,(IMM d, IMM s)) 
+MIDFUNC(2,mov_w_mi,(MEMW d, IMM s)) 
 {
     CLOBBER_MOV;
     raw_mov_w_mi(d,s) ;
 }
-MENDFUNC(2,mov_w_mi,(IMM d, IMM s)) 
+MENDFUNC(2,mov_w_mi,(MEMW d, IMM s)) 
 
-MIDFUNC(2,mov_b_mi,(IMM d, IMM s)) 
+MIDFUNC(2,mov_b_mi,(MEMW d, IMM s)) 
 {
     CLOBBER_MOV;
     raw_mov_b_mi(d,s) ;
 }
-MENDFUNC(2,mov_b_mi,(IMM d, IMM s)) 
+MENDFUNC(2,mov_b_mi,(MEMW d, IMM s)) 
 
 MIDFUNC(2,rol_b_ri,(RW1 r, IMM i))
 {
@@ -2947,12 +3247,12 @@ MIDFUNC(2,setcc,(W1 d, IMM cc))
 }
 MENDFUNC(2,setcc,(W1 d, IMM cc))
 
-MIDFUNC(2,setcc_m,(IMM d, IMM cc))
+MIDFUNC(2,setcc_m,(MEMW d, IMM cc))
 {
     CLOBBER_SETCC;
     raw_setcc_m(d,cc);
 }
-MENDFUNC(2,setcc_m,(IMM d, IMM cc))
+MENDFUNC(2,setcc_m,(MEMW d, IMM cc))
 
 MIDFUNC(3,cmov_b_rr,(RW1 d, R1 s, IMM cc))
 {
@@ -2993,14 +3293,14 @@ MIDFUNC(3,cmov_l_rr,(RW4 d, R4 s, IMM cc))
 }
 MENDFUNC(3,cmov_l_rr,(RW4 d, R4 s, IMM cc))
 
-MIDFUNC(3,cmov_l_rm,(RW4 d, IMM s, IMM cc))
+MIDFUNC(3,cmov_l_rm,(RW4 d, MEMR s, IMM cc))
 {
     CLOBBER_CMOV;
     d=rmw(d,4,4);
     raw_cmov_l_rm(d,s,cc);
     unlock2(d);
 }
-MENDFUNC(3,cmov_l_rm,(RW4 d, IMM s, IMM cc))
+MENDFUNC(3,cmov_l_rm,(RW4 d, MEMR s, IMM cc))
 
 MIDFUNC(2,bsf_l_rr,(W4 d, W4 s))
 {
@@ -3477,7 +3777,7 @@ MIDFUNC(5,mov_b_brrm_indexed,(W1 d, IMM base, R4 baser, R4 index, IMM factor))
 MENDFUNC(5,mov_b_brrm_indexed,(W1 d, IMM base, R4 baser, R4 index, IMM factor))
 
 /* Read a long from base+factor*index */
-MIDFUNC(4,mov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor))
+MIDFUNC(4,mov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor))
 {
     int indexreg=index;
 
@@ -3495,7 +3795,7 @@ MIDFUNC(4,mov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor))
     unlock2(index);
     unlock2(d);
 }
-MENDFUNC(4,mov_l_rm_indexed,(W4 d, IMM base, R4 index, IMM factor))
+MENDFUNC(4,mov_l_rm_indexed,(W4 d, MEMR base, R4 index, IMM factor))
 
 
 /* read the long at the address contained in s+offset and store in d */
@@ -3895,7 +4195,7 @@ MIDFUNC(2,mov_l_rr,(W4 d, R4 s))
 }
 MENDFUNC(2,mov_l_rr,(W4 d, R4 s))
 
-MIDFUNC(2,mov_l_mr,(IMM d, R4 s))
+MIDFUNC(2,mov_l_mr,(MEMW d, R4 s))
 {
     if (isconst(s)) {
 	COMPCALL(mov_l_mi)(d,live.state[s].val);
@@ -3907,10 +4207,10 @@ MIDFUNC(2,mov_l_mr,(IMM d, R4 s))
     raw_mov_l_mr(d,s);
     unlock2(s);
 }
-MENDFUNC(2,mov_l_mr,(IMM d, R4 s))
+MENDFUNC(2,mov_l_mr,(MEMW d, R4 s))
 
 
-MIDFUNC(2,mov_w_mr,(IMM d, R2 s))
+MIDFUNC(2,mov_w_mr,(MEMW d, R2 s))
 {
     if (isconst(s)) {
 	COMPCALL(mov_w_mi)(d,(uae_u16)live.state[s].val);
@@ -3922,9 +4222,9 @@ MIDFUNC(2,mov_w_mr,(IMM d, R2 s))
     raw_mov_w_mr(d,s);
     unlock2(s);
 }
-MENDFUNC(2,mov_w_mr,(IMM d, R2 s))
+MENDFUNC(2,mov_w_mr,(MEMW d, R2 s))
 
-MIDFUNC(2,mov_w_rm,(W2 d, IMM s))
+MIDFUNC(2,mov_w_rm,(W2 d, MEMR s))
 {
     CLOBBER_MOV;
     d=writereg(d,2);
@@ -3932,9 +4232,9 @@ MIDFUNC(2,mov_w_rm,(W2 d, IMM s))
     raw_mov_w_rm(d,s);
     unlock2(d);
 }
-MENDFUNC(2,mov_w_rm,(W2 d, IMM s))
+MENDFUNC(2,mov_w_rm,(W2 d, MEMR s))
 
-MIDFUNC(2,mov_b_mr,(IMM d, R1 s))
+MIDFUNC(2,mov_b_mr,(MEMW d, R1 s))
 {
     if (isconst(s)) {
 	COMPCALL(mov_b_mi)(d,(uae_u8)live.state[s].val);
@@ -3947,9 +4247,9 @@ MIDFUNC(2,mov_b_mr,(IMM d, R1 s))
     raw_mov_b_mr(d,s);
     unlock2(s);
 }
-MENDFUNC(2,mov_b_mr,(IMM d, R1 s))
+MENDFUNC(2,mov_b_mr,(MEMW d, R1 s))
 
-MIDFUNC(2,mov_b_rm,(W1 d, IMM s))
+MIDFUNC(2,mov_b_rm,(W1 d, MEMR s))
 {
     CLOBBER_MOV;
     d=writereg(d,1);
@@ -3957,7 +4257,7 @@ MIDFUNC(2,mov_b_rm,(W1 d, IMM s))
     raw_mov_b_rm(d,s);
     unlock2(d);
 }
-MENDFUNC(2,mov_b_rm,(W1 d, IMM s))
+MENDFUNC(2,mov_b_rm,(W1 d, MEMR s))
 
 MIDFUNC(2,mov_l_ri,(W4 d, IMM s))
 {
@@ -3987,26 +4287,26 @@ MIDFUNC(2,mov_b_ri,(W1 d, IMM s))
 MENDFUNC(2,mov_b_ri,(W1 d, IMM s))
 
 
-MIDFUNC(2,add_l_mi,(IMM d, IMM s)) 
+MIDFUNC(2,add_l_mi,(MEMRW d, IMM s)) 
 {
     CLOBBER_ADD;
     raw_add_l_mi(d,s) ;
 }
-MENDFUNC(2,add_l_mi,(IMM d, IMM s)) 
+MENDFUNC(2,add_l_mi,(MEMRW d, IMM s)) 
 
-MIDFUNC(2,add_w_mi,(IMM d, IMM s)) 
+MIDFUNC(2,add_w_mi,(MEMRW d, IMM s)) 
 {
     CLOBBER_ADD;
     raw_add_w_mi(d,s) ;
 }
-MENDFUNC(2,add_w_mi,(IMM d, IMM s)) 
+MENDFUNC(2,add_w_mi,(MEMRW d, IMM s)) 
 
-MIDFUNC(2,add_b_mi,(IMM d, IMM s)) 
+MIDFUNC(2,add_b_mi,(MEMRW d, IMM s)) 
 {
     CLOBBER_ADD;
     raw_add_b_mi(d,s) ;
 }
-MENDFUNC(2,add_b_mi,(IMM d, IMM s)) 
+MENDFUNC(2,add_b_mi,(MEMRW d, IMM s)) 
 
 
 MIDFUNC(2,test_l_ri,(R4 d, IMM i))
@@ -4108,7 +4408,7 @@ MIDFUNC(2,and_b,(RW1 d, R1 s))
 MENDFUNC(2,and_b,(RW1 d, R1 s))
 
 // gb-- used for making an fpcr value in compemu_fpp.cpp
-MIDFUNC(2,or_l_rm,(RW4 d, IMM s))
+MIDFUNC(2,or_l_rm,(RW4 d, MEMR s))
 {
     CLOBBER_OR;
     d=rmw(d,4,4);
@@ -4116,7 +4416,7 @@ MIDFUNC(2,or_l_rm,(RW4 d, IMM s))
     raw_or_l_rm(d,s);
     unlock2(d);
 }
-MENDFUNC(2,or_l_rm,(RW4 d, IMM s))
+MENDFUNC(2,or_l_rm,(RW4 d, MEMR s))
 
 MIDFUNC(2,or_l_ri,(RW4 d, IMM i))
 {
@@ -4760,14 +5060,14 @@ MIDFUNC(2,fmov_rr,(FW d, FR s))
 }
 MENDFUNC(2,fmov_rr,(FW d, FR s))
 
-MIDFUNC(2,fldcw_m_indexed,(R4 index, IMM base))
+MIDFUNC(2,fldcw_m_indexed,(R4 index, MEMR base))
 {
     index=readreg(index,4);
 
     raw_fldcw_m_indexed(index,base);
     unlock2(index);
 }
-MENDFUNC(2,fldcw_m_indexed,(R4 index, IMM base))
+MENDFUNC(2,fldcw_m_indexed,(R4 index, MEMR base))
 
 MIDFUNC(1,ftst_r,(FR r))
 {
@@ -5003,6 +5303,92 @@ static inline const char *str_on_off(bool b)
 	return b ? "on" : "off";
 }
 
+/* The A-line trap whose dispatch table entry points to addr, if any */
+static uae_u32 trap_at(uae_u32 addr)
+{
+	for (int i = 0; i < 256; i++)		// OS traps
+		if (ReadMacInt32(0x400 + 4 * i) == addr)
+			return 0xa000 + i;
+	for (int i = 0; i < 1024; i++)		// Toolbox traps
+		if (ReadMacInt32(0xe00 + 4 * i) == addr)
+			return 0xa800 + i;
+	return 0;
+}
+
+/* Tell perf about the host code of a translated block */
+static void perf_map_block(blockinfo *bi, uae_u8 *start, uae_u8 *end)
+{
+	if (perf_map == NULL)
+		return;
+	uae_u32 pc = get_virtual_address(bi->pc_p);
+	uae_u32 trap = trap_at(pc);
+	fprintf(perf_map, "%lx %lx 68k_%08x", (unsigned long)start, (unsigned long)(end - start), pc);
+	if (trap)
+		fprintf(perf_map, " trap_%04X", trap);
+	else if (pc - ROMBaseMac < ROMSize)
+		fprintf(perf_map, " ROM+%05x", pc - ROMBaseMac);
+	fprintf(perf_map, "\n");
+	fflush(perf_map);
+}
+
+/* Printed with bug(), write_log() is a no-op in this file */
+static void jit_profile_report(void)
+{
+	const int top_blocks = 20;
+
+	bug("### Compile Block statistics\n");
+	bug("Number of calls to compile_block : %d\n", compile_count);
+	clock_t emul_time = clock() - emul_start_time;
+	bug("Total emulation time   : %.1f sec\n", double(emul_time)/double(CLOCKS_PER_SEC));
+	bug("Total compilation time : %.1f sec (%.1f%%)\n", double(compile_time)/double(CLOCKS_PER_SEC),
+		100.0*double(compile_time)/double(emul_time));
+
+	// Most executed blocks
+	blockinfo *hot[top_blocks];
+	int n_hot = 0;
+	for (int l = 0; l < 2; l++) {
+		for (blockinfo *bi = l ? dormant : active; bi; bi = bi->next) {
+			if (bi->exec_count == 0)
+				continue;
+			int i = n_hot < top_blocks ? n_hot++ : top_blocks;
+			for (; i > 0 && hot[i - 1]->exec_count < bi->exec_count; i--)
+				if (i < top_blocks)
+					hot[i] = hot[i - 1];
+			if (i < top_blocks)
+				hot[i] = bi;
+		}
+	}
+	bug("\nRank  68k PC        Entries  Compile (us)\n");
+	for (int i = 0; i < n_hot; i++) {
+		uae_u32 pc = get_virtual_address(hot[i]->pc_p);
+		uae_u32 trap = trap_at(pc);
+		if (trap)
+			bug("%03d: %08x %10u %10lu  trap %04X\n", i, pc, hot[i]->exec_count,
+				(unsigned long)(hot[i]->compile_clock * (1000000.0 / CLOCKS_PER_SEC)), trap);
+		else
+			bug("%03d: %08x %10u %10lu\n", i, pc, hot[i]->exec_count,
+				(unsigned long)(hot[i]->compile_clock * (1000000.0 / CLOCKS_PER_SEC)));
+	}
+
+	// Most executed untranslated instructions
+	for (int i = 0; i < 65536; i++)
+		opcode_nums[i] = i;
+	qsort(opcode_nums, 65536, sizeof(uae_u16), untranslated_compfn);
+	bug("\nRank  Opc      Count Name\n");
+	for (int i = 0; i < untranslated_top_ten; i++) {
+		uae_u32 count = raw_cputbl_count[opcode_nums[i]];
+		struct instr *dp;
+		struct mnemolookup *lookup;
+		if (!count)
+			break;
+		dp = table68k + opcode_nums[i];
+		for (lookup = lookuptab; lookup->mnemo != dp->mnemo; lookup++)
+			;
+		bug("%03d: %04x %10lu %s\n", i, opcode_nums[i], (unsigned long)count, lookup->name);
+	}
+	bug("\n");
+}
+
 void compiler_init(void)
 {
 	static bool initialized = false;
@@ -5039,6 +5425,24 @@ void compiler_init(void)
 	lazy_flush = PrefsFindBool("jitlazyflush");
 	write_log("<JIT compiler> : lazy translation cache invalidation : %s\n", str_on_off(lazy_flush));
 	flush_icache = lazy_flush ? flush_icache_lazy : flush_icache_hard;
+#if USE_CHECKSUM_INFO
+	smc_protect = PrefsFindBool("jitsmcprotect") && smc_init();
+#endif
+	write_log("<JIT compiler> : write-protect translated RAM pages : %s\n", str_on_off(smc_protect));
+	
+	// When instructions are counted, the count has to come out the same on
+	// every run. Translating in another thread makes the point where code
+	// starts running translated depend on the host, and traces charge all
+	// their instructions on entry, even when they are left early
+#ifdef USE_CPU_EMUL_TICKS
+	const bool exact_count = cpu_count_ticks;
+#else
+	const bool exact_count = false;
+#endif
+#if USE_COMPILE_THREAD
+	compile_thread_active = PrefsFindBool("jitthread") && !exact_count && compile_thread_init();
+	write_log("<JIT compiler> : translate in a separate thread : %s\n", str_on_off(compile_thread_active));
+#endif
 	
 	// Compiler features
 	write_log("<JIT compiler> : register aliasing : %s\n", str_on_off(1));
@@ -5048,28 +5452,51 @@ void compiler_init(void)
 	follow_const_jumps = PrefsFindBool("jitinline");
 #endif
 	write_log("<JIT compiler> : translate through constant jumps : %s\n", str_on_off(follow_const_jumps));
+	predict_branches = PrefsFindBool("jitpredict");
+	write_log("<JIT compiler> : predict indirect jumps and returns : %s\n", str_on_off(predict_branches));
+	
+	// Second translation tier: hot blocks are translated again as traces
+	if (PrefsFindBool("jittrace") && !exact_count)
+		optcount[TRACE_OPTLEVEL - 1] = TRACE_THRESHOLD;
+	write_log("<JIT compiler> : translate hot blocks as traces : %s\n", str_on_off(optcount[TRACE_OPTLEVEL - 1] > 0));
 	write_log("<JIT compiler> : separate blockinfo allocation : %s\n", str_on_off(USE_SEPARATE_BIA));
 	
+	// Profiling of translated code, and a map of it for perf
+	jit_profile = PrefsFindBool("jitprofile");
+	write_log("<JIT compiler> : gather execution and translation statistics : %s\n", str_on_off(jit_profile));
+	if (jit_profile) {
+		char name[64];
+		sprintf(name, "/tmp/perf-%d.map", (int)getpid());
+		perf_map = fopen(name, "w");
+		if (perf_map)
+			write_log("<JIT compiler> : writing perf map to %s\n", name);
+		emul_start_time = clock();
+		last_profile_report = time(NULL);
+	}
+	
+	// Translations of ROM code from previous runs
+	rom_cache_path = PrefsFindString("jitromcache");
+	if (rom_cache_path && rom_cache_path[0] == 0)
+		rom_cache_path = NULL;
+	write_log("<JIT compiler> : keep ROM translations across runs : %s\n", str_on_off(rom_cache_path != NULL));
+	
 	// Build compiler tables
 	build_comp();
 	
 	initialized = true;
-	
-#if PROFILE_UNTRANSLATED_INSNS
-	write_log("<JIT compiler> : gather statistics on untranslated insns count\n");
-#endif
-
-#if PROFILE_COMPILE_TIME
-	write_log("<JIT compiler> : gather statistics on translation time\n");
-	emul_start_time = clock();
-#endif
 }
 
 void compiler_exit(void)
 {
-#if PROFILE_COMPILE_TIME
-	emul_end_time = clock();
+#if USE_COMPILE_THREAD
+	if (compile_thread_active) {
+		compile_thread_exit();
+		compile_thread_active = false;
+	}
 #endif
+
+	if (rom_cache_path)
+		rom_cache_save();
 	
 	// Deallocate translation cache
 	if (compiled_code) {
@@ -5082,38 +5509,26 @@ void compiler_exit(void)
 		vm_release(popallspace, POPALLSPACE_SIZE);
 		popallspace = 0;
 	}
-	
-#if PROFILE_COMPILE_TIME
-	write_log("### Compile Block statistics\n");
-	write_log("Number of calls to compile_block : %d\n", compile_count);
-	uae_u32 emul_time = emul_end_time - emul_start_time;
-	write_log("Total emulation time   : %.1f sec\n", double(emul_time)/double(CLOCKS_PER_SEC));
-	write_log("Total compilation time : %.1f sec (%.1f%%)\n", double(compile_time)/double(CLOCKS_PER_SEC),
-		100.0*double(compile_time)/double(emul_time));
-	write_log("\n");
-#endif
 
-#if PROFILE_UNTRANSLATED_INSNS
-	uae_u64 untranslated_count = 0;
-	for (int i = 0; i < 65536; i++) {
-		opcode_nums[i] = i;
-		untranslated_count += raw_cputbl_count[i];
-	}
-	write_log("Sorting out untranslated instructions count...\n");
-	qsort(opcode_nums, 65536, sizeof(uae_u16), untranslated_compfn);
-	write_log("\nRank  Opc      Count Name\n");
-	for (int i = 0; i < untranslated_top_ten; i++) {
-		uae_u32 count = raw_cputbl_count[opcode_nums[i]];
-		struct instr *dp;
-		struct mnemolookup *lookup;
-		if (!count)
-			break;
-		dp = table68k + opcode_nums[i];
-		for (lookup = lookuptab; lookup->mnemo != dp->mnemo; lookup++)
-			;
-		write_log("%03d: %04x %10lu %s\n", i, opcode_nums[i], count, lookup->name);
-	}
+	write_log("<JIT compiler> : translation cache flushes : %d hard, %d soft, %d segments\n",
+			  hard_flush_count, soft_flush_count, segment_flush_count);
+	for (int i = 0; i < cache_segments; i++)
+		write_log("<JIT compiler> : segment %d reclaimed %u times\n", i, segment_evict_count[i]);
+	write_log("<JIT compiler> : blocks evicted : %u, survived : %u\n", evicted_block_count, survived_block_count);
+	if (smc_protect)
+		write_log("<JIT compiler> : write-protection faults : %d, blocks kept across flushes : %d\n",
+				  smc_fault_count, smc_guarded_count);
+#if USE_CHECKSUM_INFO
+	smc_exit();
 #endif
+	
+	if (jit_profile) {
+		jit_profile_report();
+		if (perf_map) {
+			fclose(perf_map);
+			perf_map = NULL;
+		}
+	}
 
 #if RECORD_REGISTER_USAGE
 	int reg_count_ids[16];
@@ -5383,6 +5798,14 @@ static __inline__ bool isinrom(uintptr addr)
 	return ((addr >= (uintptr)ROMBaseHost) && (addr < (uintptr)ROMBaseHost + ROMSize));
 }
 
+/* Whether an instruction can be read at addr */
+static __inline__ bool isincode(uintptr addr)
+{
+	if (addr >= (uintptr)RAMBaseHost && addr + LONGEST_68K_INST <= (uintptr)RAMBaseHost + RAMSize)
+		return true;
+	return ((addr >= (uintptr)ROMBaseHost) && (addr + LONGEST_68K_INST <= (uintptr)ROMBaseHost + ROMSize));
+}
+
 static void flush_all(void)
 {
     int i;
@@ -5438,20 +5861,13 @@ void register_branch(uae_u32 not_taken, uae_u32 taken, uae_u8 cond)
 }
 
 
-static uae_u32 get_handler_address(uae_u32 addr)
+static uintptr get_handler_address(uae_u32 addr)
 {
     uae_u32 cl=cacheline(addr);
     blockinfo* bi=get_blockinfo_addr_new((void*)(uintptr)addr,0);
     return (uintptr)&(bi->direct_handler_to_use);
 }
 
-static uae_u32 get_handler(uae_u32 addr)
-{
-    uae_u32 cl=cacheline(addr);
-    blockinfo* bi=get_blockinfo_addr_new((void*)(uintptr)addr,0);
-    return (uintptr)bi->direct_handler_to_use;
-}
-
 static void load_handler(int reg, uae_u32 addr)
 {
     mov_l_rm(reg,get_handler_address(addr));
@@ -5672,62 +6088,56 @@ uae_u32 get_jitted_size(void)
     return 0;
 }
 
-const int CODE_ALLOC_MAX_ATTEMPTS = 10;
-const int CODE_ALLOC_BOUNDARIES   = 128 * 1024; // 128 KB
-
-static uint8 *do_alloc_code(uint32 size, int depth)
-{
-#if defined(__linux__) && 0
-	/*
-	  This is a really awful hack that is known to work on Linux at
-	  least.
-	  
-	  The trick here is to make sure the allocated cache is nearby
-	  code segment, and more precisely in the positive half of a
-	  32-bit address space. i.e. addr < 0x80000000. Actually, it
-	  turned out that a 32-bit binary run on AMD64 yields a cache
-	  allocated around 0xa0000000, thus causing some troubles when
-	  translating addresses from m68k to x86.
-	*/
-	static uint8 * code_base = NULL;
-	if (code_base == NULL) {
-		uintptr page_size = getpagesize();
-		uintptr boundaries = CODE_ALLOC_BOUNDARIES;
-		if (boundaries < page_size)
-			boundaries = page_size;
-		code_base = (uint8 *)sbrk(0);
-		for (int attempts = 0; attempts < CODE_ALLOC_MAX_ATTEMPTS; attempts++) {
-			if (vm_acquire_fixed(code_base, size) == 0) {
-				uint8 *code = code_base;
-				code_base += size;
-				return code;
-			}
-			code_base += boundaries;
-		}
-		return NULL;
-	}
+void compiler_get_stats(compiler_stats *stats)
+{
+    stats->compiled_blocks = compile_count;
+    stats->evicted_blocks = evicted_block_count;
+    stats->untranslated_fpu = untranslated_fpu_count;
+    stats->jitted_size = get_jitted_size();
+    stats->hard_flushes = hard_flush_count;
+    stats->soft_flushes = soft_flush_count;
+    stats->compile_seconds = double(compile_time) / double(CLOCKS_PER_SEC);
+}
 
-	if (vm_acquire_fixed(code_base, size) == 0) {
-		uint8 *code = code_base;
-		code_base += size;
-		return code;
-	}
+/* Translated code is kept within this distance of the emulator image so
+   that calls into the interpreter and references to regs, cache_tags and
+   the popall stubs fit into 32-bit displacements. The code generator
+   still copes with anything farther away, only with longer sequences. */
+const size_t CODE_ALLOC_REACH = 0x40000000; // 1 GB
 
-	if (depth >= CODE_ALLOC_MAX_ATTEMPTS)
-		return NULL;
+static inline bool code_within_reach(uint8 *p, uint8 *anchor, uint32 size)
+{
+	const intptr lo = (intptr)p - (intptr)anchor;
+	const intptr hi = lo + size;
+	return lo >= -(intptr)CODE_ALLOC_REACH && hi <= (intptr)CODE_ALLOC_REACH;
+}
 
-	return do_alloc_code(size, depth + 1);
-#else
-	uint8 *code = (uint8 *)vm_acquire(size);
-	return code == VM_MAP_FAILED ? NULL : code;
+static uint8 *do_alloc_code(uint32 size, uint8 *anchor)
+{
+	uint8 *code;
+#if defined(__x86_64__)
+	code = (uint8 *)vm_acquire_near(anchor, size, CODE_ALLOC_REACH);
+	if (code != VM_MAP_FAILED)
+		return code;
 #endif
+	// Fallback to the low 2 GB, as the rest of the program image would be
+	// if it was not built as a position-independent executable
+	code = (uint8 *)vm_acquire(size, VM_MAP_DEFAULT | VM_MAP_32BIT);
+	return code == VM_MAP_FAILED ? NULL : code;
 }
 
 static inline uint8 *alloc_code(uint32 size)
 {
-	uint8 *ptr = do_alloc_code(size, 0);
-	/* allocated code must fit in 32-bit boundaries */
-	assert((uintptr)ptr <= 0xffffffff);
+	// All code buffers go next to the popall stubs, so that they can
+	// branch to each other with 32-bit displacements
+	uint8 *anchor = popallspace ? popallspace : (uint8 *)&regs;
+	uint8 *ptr = do_alloc_code(size, anchor);
+#if defined(__x86_64__)
+	if (ptr && popallspace && !code_within_reach(ptr, popallspace, size)) {
+		vm_release(ptr, size);
+		ptr = NULL;
+	}
+#endif
 	return ptr;
 }
 
@@ -5742,17 +6152,28 @@ void alloc_cache(void)
 	if (cache_size == 0)
 		return;
 	
+	const uae_u32 requested_size = cache_size;
 	while (!compiled_code && cache_size) {
 		if ((compiled_code = alloc_code(cache_size * 1024)) == NULL) {
 			compiled_code = 0;
 			cache_size /= 2;
 		}
 	}
-	vm_protect(compiled_code, cache_size * 1024, VM_PAGE_READ | VM_PAGE_WRITE | VM_PAGE_EXECUTE);
+	if (cache_size != requested_size)
+		write_log("<JIT compiler> : WARNING: could not allocate a %d KB translation cache, using %d KB\n", requested_size, cache_size);
 	
 	if (compiled_code) {
-		write_log("<JIT compiler> : actual translation cache size : %d KB at 0x%08X\n", cache_size, compiled_code);
-		max_compile_start = compiled_code + cache_size*1024 - BYTES_PER_INST;
+		vm_protect(compiled_code, cache_size * 1024, VM_PAGE_READ | VM_PAGE_WRITE | VM_PAGE_EXECUTE);
+		write_log("<JIT compiler> : actual translation cache size : %d KB at %p\n", cache_size, compiled_code);
+		// Blockinfos must not live in the translation cache for segments
+		// to be reclaimed independently
+		cache_segments = USE_SEPARATE_BIA ? CACHE_SEGMENTS : 1;
+		while (cache_segments > 1 && cache_size * 1024 / cache_segments < MIN_SEGMENT_SIZE)
+			cache_segments /= 2;
+		segment_size = cache_size * 1024 / cache_segments;
+		write_log("<JIT compiler> : translation cache segments : %d x %d KB\n", cache_segments, segment_size / 1024);
+		current_segment = 0;
+		max_compile_start = compiled_code + segment_size - BYTES_PER_INST;
 		current_compile_p = compiled_code;
 		current_cache_size = 0;
 	}
@@ -5910,6 +6331,10 @@ static inline int block_check_checksum(blockinfo* bi)
 	add_to_active(bi);
 	raise_in_cl_list(bi);
 	bi->status=BI_ACTIVE;
+#if USE_CHECKSUM_INFO
+	if (smc_protect)
+	    smc_protect_block(bi);
+#endif
     }
     else {
 	/* This block actually changed. We need to invalidate it,
@@ -5918,6 +6343,7 @@ static inline int block_check_checksum(blockinfo* bi)
 	   c1,c2,bi->c1,bi->c2); */
 	invalidate_block(bi);
 	raise_in_cl_list(bi);
+	flush_flag_callers(bi,1);
     }
     return isgood;
 }
@@ -5929,7 +6355,7 @@ static int called_check_checksum(blockinfo* bi)
     int i;
     
     for (i=0;i<2 && isgood;i++) {
-	if (bi->dep[i].jmp_off) {
+	if (bi->dep[i].target) {
 	    isgood=block_check_checksum(bi->dep[i].target);
 	}
     }
@@ -5960,6 +6386,24 @@ static void check_checksum(void)
 	execute_normal();
 }
 
+/* Whether the pinned registers a block loads on entry can be handed over
+   in place, so that jumps go past the loads */
+static __inline__ int can_enter_pinned(blockinfo* bi)
+{
+    return bi->havestate &&
+	(bi->status==BI_ACTIVE || bi->status==BI_COMPILING ||
+	 bi->status==BI_FINALIZING) &&
+	bi->direct_handler_to_use==bi->direct_handler;
+}
+
+/* Where to jump to after match_states() */
+static __inline__ uintptr get_matched_handler(blockinfo* bi)
+{
+    if (can_enter_pinned(bi))
+	return (uintptr)bi->direct_pinned;
+    return (uintptr)bi->direct_handler_to_use;
+}
+
 static __inline__ void match_states(blockinfo* bi)
 {
     int i;
@@ -5980,6 +6424,8 @@ static __inline__ void match_states(blockinfo* bi)
 	}
     }
     flush(1);
+    if (!can_enter_pinned(bi))
+	return;
 
     /* And now deal with the *demands* the block makes */
     for (i=0;i<N_REGS;i++) {
@@ -6040,7 +6486,8 @@ static __inline__ void create_popalls(void)
   r=REG_PC_TMP;
   raw_mov_l_rm(r,(uintptr)&regs.pc_p);
   raw_and_l_ri(r,TAGMASK);
-  raw_jmp_m_indexed((uintptr)cache_tags,r,SIZEOF_VOID_P);
+  raw_mov_p_ri(REG_PC_PRE,(uintptr)cache_tags);
+  raw_jmp_rm_indexed(REG_PC_PRE,r,SIZEOF_VOID_P);
 
   /* now the exit points */
   align_target(align_jumps);
@@ -6097,6 +6544,11 @@ static __inline__ void create_popalls(void)
   }
   raw_jmp((uintptr)check_checksum);
 
+  if (perf_map) {
+	  fprintf(perf_map, "%lx %lx JIT_stubs\n", (unsigned long)popallspace, (unsigned long)(get_target() - popallspace));
+	  fflush(perf_map);
+  }
+
   // no need to further write into popallspace
   vm_protect(popallspace, POPALLSPACE_SIZE, VM_PAGE_READ | VM_PAGE_EXECUTE);
 }
@@ -6111,10 +6563,8 @@ static __inline__ void reset_lists(void)
     dormant=NULL;
 }
 
-static void prepare_block(blockinfo* bi)
+static void prepare_block_stubs(blockinfo* bi)
 {
-    int i;
-
     set_target(current_compile_p);
     align_target(align_jumps);
     bi->direct_pen=(cpuop_func *)get_target();
@@ -6128,6 +6578,13 @@ static void prepare_block(blockinfo* bi)
     raw_mov_l_mr((uintptr)&regs.pc_p,0);
     raw_jmp((uintptr)popall_check_checksum);
     current_compile_p=get_target();
+}
+
+static void prepare_block(blockinfo* bi)
+{
+    int i;
+
+    prepare_block_stubs(bi);
 
     bi->deplist=NULL;
     for (i=0;i<2;i++) {
@@ -6137,6 +6594,9 @@ static void prepare_block(blockinfo* bi)
     bi->env=default_ss;
     bi->status=BI_INVALID;
     bi->havestate=0;
+    bi->flagdeps=0;
+    bi->exec_count=0;
+    bi->compile_clock=0;
     //bi->env=empty_ss;
 }
 
@@ -6244,6 +6704,7 @@ void build_comp(void)
 		prop[opcode].use_flags = 0x1f;
 		prop[opcode].set_flags = 0x1f;
 		prop[opcode].cflow = fl_trap; // ILLEGAL instructions do trap
+		prop[opcode].is_cond_branch = 0;
 	}
 	
 	for (i = 0; tbl[i].opcode < 65536; i++) {
@@ -6304,6 +6765,12 @@ void build_comp(void)
 		 * don't actually use any flags themselves */
 		if (prop[cft_map(opcode)].cflow & fl_const_jump)
 			prop[cft_map(opcode)].use_flags = 0;
+		/* Bcc and DBF register both outcomes of the branch with constant
+		 * targets (see gencomp.c), other conditional jumps don't */
+		prop[cft_map(opcode)].is_cond_branch =
+			(table68k[opcode].mnemo == i_Bcc && table68k[opcode].cc >= 2 &&
+			 table68k[opcode].cc != 8 && table68k[opcode].cc != 9) ||
+			(table68k[opcode].mnemo == i_DBcc && table68k[opcode].cc == 1);
     }
 	for (i = 0; nfctbl[i].handler != NULL; i++) {
 		if (nfctbl[i].specific)
@@ -6382,6 +6849,140 @@ static void flush_icache_hard(int n)
     if (!compiled_code)
 	return;
     current_compile_p=compiled_code;
+    current_segment=0;
+    max_compile_start=compiled_code+segment_size-BYTES_PER_INST;
+	SPCFLAGS_SET( SPCFLAG_JIT_EXEC_RETURN ); /* To get out of compiled code */
+}
+
+
+/* Segmented flushing --- the translation cache is a ring of segments
+   filled in turn. When the current one is full, only the oldest segment
+   (the next one in the ring) is reclaimed:
+   - blocks whose code lives there are thrown away, and direct jumps into
+     them from younger segments are turned into exits to the dispatcher;
+   - blocks that are still jumped to from younger segments are part of the
+     working set: they keep their blockinfo and optimization level, and
+     are recompiled right away the next time they are reached;
+   - blocks that only had their entry stubs there get new ones.
+*/
+
+static __inline__ bool in_segment(const void* p, uae_u8* start, uae_u8* end)
+{
+    return (uae_u8*)p>=start && (uae_u8*)p<end;
+}
+
+static __inline__ bool block_survives_flush(blockinfo* bi)
+{
+    /* Jumps from the reclaimed segment were already removed */
+    return bi->status==BI_ACTIVE && bi->optlevel>0 && bi->deplist!=NULL;
+}
+
+static void evict_block(blockinfo* bi)
+{
+    dependency* x;
+
+    /* Nothing will tell when the code of an evicted block changes */
+    flush_flag_callers(bi,1);
+
+    x=bi->deplist;
+    while (x) {
+	dependency* next=x->next;
+	/* Fall through to the "set regs.pc_p and leave" path that follows
+	   every direct jump to another block */
+	if (x->jmp_off)
+	    adjust_jmpdep(x,(cpuop_func *)(x->jmp_off+1));
+	x->jmp_off=NULL;
+	x->target=NULL;
+	remove_dep(x);
+	x=next;
+    }
+    remove_deps(bi);
+    remove_from_lists(bi);
+    free_blockinfo(bi);
+    evicted_block_count++;
+}
+
+static void relocate_block_stubs(blockinfo* bi)
+{
+    cpuop_func* old_pen=bi->direct_pen;
+    cpuop_func* old_pcc=bi->direct_pcc;
+
+    prepare_block_stubs(bi);
+    if (bi->direct_handler==old_pen)
+	bi->direct_handler=bi->direct_pen;
+    if (bi->direct_handler_to_use==old_pen)
+	set_dhtu(bi,bi->direct_pen);
+    else if (bi->direct_handler_to_use==old_pcc)
+	set_dhtu(bi,bi->direct_pcc);
+}
+
+static void flush_icache_segment(int n)
+{
+    blockinfo* bi;
+    blockinfo* lists[2];
+    int i;
+
+    if (cache_segments<2) {
+	flush_icache_hard(n);
+	return;
+    }
+
+    int segment=(current_segment+1)%cache_segments;
+    uae_u8* start=compiled_code+segment*segment_size;
+    uae_u8* end=start+segment_size;
+
+    segment_flush_count++;
+    segment_evict_count[segment]++;
+
+    /* Jumps emitted in that segment go away, including those from code
+       that was left behind by a recompilation */
+    lists[0]=active;
+    lists[1]=dormant;
+    for (i=0;i<2;i++) {
+	for (bi=lists[i];bi;bi=bi->next) {
+	    for (int j=0;j<2;j++) {
+		if (in_segment(bi->dep[j].jmp_off,start,end)) {
+		    remove_dep(&(bi->dep[j]));
+		    bi->dep[j].jmp_off=NULL;
+		    bi->dep[j].target=NULL;
+		}
+	    }
+	}
+    }
+
+    current_segment=segment;
+    current_compile_p=start;
+    max_compile_start=end-BYTES_PER_INST;
+
+    /* From now on, only code from other segments refers to these blocks */
+    for (i=0;i<2;i++) {
+	bi=(i==0) ? active : dormant;
+	while (bi) {
+	    blockinfo* next=bi->next;
+	    bool code_in=in_segment((void*)bi->direct_handler,start,end);
+	    bool stubs_in=in_segment((void*)bi->direct_pen,start,end);
+
+	    if (code_in && !block_survives_flush(bi))
+		evict_block(bi);
+	    else {
+		if (stubs_in)
+		    relocate_block_stubs(bi);
+		if (code_in) {
+		    block_need_recompile(bi);
+		    survived_block_count++;
+		}
+	    }
+	    bi=next;
+	}
+    }
+    for (i=0;i<MAX_HOLD_BI;i++) {
+	if (hold_bi[i] && in_segment((void*)hold_bi[i]->direct_pen,start,end))
+	    prepare_block(hold_bi[i]);
+    }
+
+#if USE_COMPILE_THREAD
+	if (!compiling_in_thread) /* The emulation thread is not in compiled code then */
+#endif
 	SPCFLAGS_SET( SPCFLAG_JIT_EXEC_RETURN ); /* To get out of compiled code */
 }
 
@@ -6399,6 +7000,22 @@ static inline void flush_icache_lazy(int n)
 	if (!active)
 	    return;
 
+#if USE_CHECKSUM_INFO
+	if (smc_protect) {
+	    /* Blocks on protected pages can't have changed */
+	    bi=active;
+	    while (bi) {
+		bi2=bi->next;
+		if (bi->status==BI_ACTIVE && smc_block_guarded(bi))
+		    smc_guarded_count++;
+		else
+		    flush_block(bi);
+		bi=bi2;
+	    }
+	    return;
+	}
+#endif
+
 	bi=active;
 	while (bi) {
 	    uae_u32 cl=cacheline(bi->pc_p);
@@ -6430,49 +7047,148 @@ static inline void flush_icache_lazy(int n)
 	active=NULL;
 }
 
+/* Invalidate a block whose 68k code may have changed */
+static void flush_block(blockinfo *bi)
+{
+	uae_u32 cl = cacheline(bi->pc_p);
+	if (!lazy_flush || bi->status == BI_INVALID || bi->status == BI_NEED_RECOMP) {
+		if (bi == cache_tags[cl+1].bi) 
+			cache_tags[cl].handler = (cpuop_func *)popall_execute_normal;
+		bi->handler_to_use = (cpuop_func *)popall_execute_normal;
+		set_dhtu(bi, bi->direct_pen);
+		bi->status = BI_INVALID;
+	}
+	else {
+		if (bi == cache_tags[cl+1].bi) 
+			cache_tags[cl].handler = (cpuop_func *)popall_check_checksum;
+		bi->handler_to_use = (cpuop_func *)popall_check_checksum;
+		set_dhtu(bi, bi->direct_pcc);
+		bi->status = BI_NEED_CHECK;
+	}
+	remove_from_list(bi);
+	add_to_dormant(bi);
+	flush_flag_callers(bi, 0);
+}
+
+#if USE_CHECKSUM_INFO
+/* Flush the blocks translated from [start, end), which must not span more
+   pages than the range index holds */
+static void flush_blocks_in_range(uintptr start, uintptr end)
+{
+	const uintptr first = start >> RANGE_PAGE_SHIFT;
+	const uintptr last = (end - 1) >> RANGE_PAGE_SHIFT;
+	for (uintptr page = first; page <= last; page++) {
+		range_link *rl = range_index[page & (RANGE_INDEX_SIZE - 1)];
+		while (rl) {
+			blockinfo *bi = rl->bi;
+			rl = rl->next;
+			if (bi->status == BI_INVALID || bi->status == BI_NEED_CHECK)
+				continue;
+			if (smc_protect && smc_block_guarded(bi)) {
+				smc_guarded_count++;
+				continue;
+			}
+			for (checksum_info *csi = bi->csi; csi; csi = csi->next) {
+				if ((uintptr)csi->start_p < end && start < (uintptr)csi->start_p + csi->length) {
+					flush_block(bi);
+					break;
+				}
+			}
+		}
+	}
+}
+
+/* Flush the blocks of the pages written since they were protected. Only
+   called from the compiled code loop, outside of any block */
+static void smc_flush_written_pages(void)
+{
+	smc_pages_written = false;
+	const uae_u32 group_count = (smc_page_count >> SMC_GROUP_SHIFT) + 1;
+	for (uae_u32 g = 0; g < group_count; g++) {
+		if (!smc_written_groups[g])
+			continue;
+		smc_written_groups[g] = 0;
+		const uae_u32 first = g << SMC_GROUP_SHIFT;
+		const uae_u32 last = first + (1 << SMC_GROUP_SHIFT) < smc_page_count ? first + (1 << SMC_GROUP_SHIFT) : smc_page_count;
+		for (uae_u32 i = first; i < last; i++) {
+			smc_page_info *info = &smc_pages[i];
+			if (info->state != SMC_PAGE_WRITTEN)
+				continue;
+			// The page may have been protected again behind a concurrent write
+			uae_u8 *page = smc_page_address(info);
+			vm_protect(page, smc_page_size, VM_PAGE_DEFAULT);
+			info->state = ++info->faults >= SMC_MAX_FAULTS ? SMC_PAGE_UNGUARDED : SMC_PAGE_CLEAN;
+			flush_blocks_in_range((uintptr)page, (uintptr)page + smc_page_size);
+		}
+	}
+}
+#endif
+
+/* Called by the SIGSEGV handler: a write hit a page holding translated code */
+bool compiler_write_fault(void *fault_address)
+{
+#if USE_CHECKSUM_INFO
+	if (smc_protect) {
+		smc_page_info *info = smc_page_of((uintptr)fault_address);
+		if (info && smc_unprotect_page(info)) {
+			smc_fault_count++;
+			return true;
+		}
+	}
+#endif
+	return false;
+}
+
+/* Host code is about to write Mac memory behind the CPU's back, e.g. with
+   read(), which would fail on a write-protected page instead of faulting */
+void compiler_prepare_write(void *start, uae_u32 length)
+{
+#if USE_CHECKSUM_INFO
+	if (smc_protect && length) {
+		const uintptr end = (uintptr)start + length;
+		for (uintptr p = (uintptr)start; p < end; p = (p | (smc_page_size - 1)) + 1) {
+			smc_page_info *info = smc_page_of(p);
+			if (info)
+				smc_unprotect_page(info);
+		}
+	}
+#endif
+}
+
 void flush_icache_range(uae_u8 *start_p, uae_u32 length)
 {
+#if USE_COMPILE_THREAD
+	compile_thread_wait();
+#endif
 	if (!active)
 		return;
 
 #if LAZY_FLUSH_ICACHE_RANGE
-	blockinfo *bi = active;
-	while (bi) {
+	if (start_p == NULL) {
+		flush_icache(-1);
+		return;
+	}
 #if USE_CHECKSUM_INFO
-		bool candidate = false;
-		for (checksum_info *csi = bi->csi; csi; csi = csi->next) {
-			if (((start_p - csi->start_p) < csi->length) ||
-				((csi->start_p - start_p) < length)) {
-				candidate = true;
-				break;
-			}
-		}
+	const uintptr start = (uintptr)start_p;
+	const uintptr end = start + length;
+	if (length == 0)
+		return;
+	if (((end - 1) >> RANGE_PAGE_SHIFT) - (start >> RANGE_PAGE_SHIFT) >= RANGE_INDEX_SIZE) {
+		flush_icache(-1);
+		return;
+	}
+	flush_blocks_in_range(start, end);
 #else
+	blockinfo *bi = active;
+	while (bi) {
 		// Assume system is consistent and would invalidate the right range
-		const bool candidate = (bi->pc_p - start_p) < length;
-#endif
+		const bool candidate = (uintptr)(bi->pc_p - start_p) < length;
 		blockinfo *dbi = bi;
 		bi = bi->next;
-		if (candidate) {
-			uae_u32 cl = cacheline(dbi->pc_p);
-			if (dbi->status == BI_INVALID || dbi->status == BI_NEED_RECOMP) {
-				if (dbi == cache_tags[cl+1].bi) 
-					cache_tags[cl].handler = (cpuop_func *)popall_execute_normal;
-				dbi->handler_to_use = (cpuop_func *)popall_execute_normal;
-				set_dhtu(dbi, dbi->direct_pen);
-				dbi->status = BI_INVALID;
-			}
-			else {
-				if (dbi == cache_tags[cl+1].bi) 
-					cache_tags[cl].handler = (cpuop_func *)popall_check_checksum;
-				dbi->handler_to_use = (cpuop_func *)popall_check_checksum;
-				set_dhtu(dbi, dbi->direct_pcc);
-				dbi->status = BI_NEED_CHECK;
-			}
-			remove_from_list(dbi);
-			add_to_dormant(dbi);
-		}
+		if (candidate)
+			flush_block(dbi);
 	}
+#endif
 	return;
 #endif
 	flush_icache(-1);
@@ -6588,19 +7304,207 @@ void compiler_dumpstate(void)
 }
 #endif
 
-static void compile_block(cpu_history* pc_hist, int blocklen)
+/* Assign homes in pinned_regs[] for a block about to be translated. The
+   registers that are read before anything else is put at their home, and
+   before the first interpreted instruction, are returned in env: they get
+   loaded at the start of the block */
+static void ra_plan(cpu_history* pc_hist, int blocklen, smallstate* env)
+{
+    int weight[16];
+    int readfirst[16];
+    int order[16];
+    int holder[N_REGS];
+    int first_interp=blocklen;
+    int n=0;
+    int i,j,r;
+
+    for (r=0;r<16;r++) {
+	ra_home[r]=-1;
+	ra_start[r]=ra_end[r]=-1;
+	weight[r]=0;
+    }
+    for (i=0;i<blocklen;i++) {
+	uae_u32 opcode=DO_GET_OPCODE(pc_hist[i].location);
+	regusage ru;
+
+	if (!compfunctbl[opcode] && !nfcompfunctbl[opcode]) {
+	    /* Interpreted, registers are in memory anyway */
+	    if (first_interp>i)
+		first_interp=i;
+	    continue;
+	}
+	comp_pc_p=(uae_u8*)pc_hist[i].location;
+	m68k_pc_offset=0;
+	ru_fill(&ru,opcode);
+	if (ru.rmask==0xffff && ru.wmask==0xffff)
+	    continue;
+	for (r=0;r<16;r++) {
+	    if (!((ru.rmask|ru.wmask)&(1<<r)))
+		continue;
+	    if (ra_start[r]<0) {
+		ra_start[r]=i;
+		readfirst[r]=(ru.rmask>>r)&1;
+	    }
+	    ra_end[r]=i;
+	    weight[r]++;
+	}
+    }
+    m68k_pc_offset=0;
+
+    /* Live ranges by start */
+    for (r=0;r<16;r++) {
+	if (weight[r]<RA_MIN_USES)
+	    continue;
+	for (i=n;i>0 && ra_start[order[i-1]]>ra_start[r];i--)
+	    order[i]=order[i-1];
+	order[i]=r;
+	n++;
+    }
+
+    /* A range takes a home that is free by now, or the one of the least
+       used range still live if it is used more than that */
+    for (j=0;pinned_regs[j]>=0;j++)
+	holder[j]=-1;
+    for (i=0;i<n;i++) {
+	int spill=-1;
+
+	r=order[i];
+	for (j=0;pinned_regs[j]>=0;j++) {
+	    if (holder[j]<0 || ra_end[holder[j]]<ra_start[r])
+		break;
+	    if (spill<0 || weight[holder[j]]<weight[holder[spill]])
+		spill=j;
+	}
+	if (pinned_regs[j]<0) {
+	    if (spill<0 || weight[holder[spill]]>=weight[r])
+		continue;
+	    ra_home[holder[spill]]=-1;
+	    j=spill;
+	}
+	ra_home[r]=pinned_regs[j];
+	holder[j]=r;
+    }
+
+    /* The first range at each home is loaded on entry */
+    *env=default_ss;
+    for (r=0;r<16;r++) {
+	int h=ra_home[r];
+	if (h<0 || !readfirst[r] || ra_start[r]>first_interp)
+	    continue;
+	for (i=0;i<16;i++) {
+	    if (i!=r && ra_home[i]==h && ra_start[i]<ra_start[r])
+		break;
+	}
+	if (i==16)
+	    env->nat[h]=r;
+    }
+    ra_set_pos(-1);
+}
+
+/* Where execution goes on after a block ending with the instruction at
+   pc, as far as it is known before translation. Returns the number of
+   addresses stored in succ */
+static int block_successors(uae_u16* pc, uintptr* succ)
+{
+    uae_u32 opcode=do_get_mem_word(pc);
+    uae_s32 disp;
+    int len;
+
+    if ((opcode&0xf000)==0x6000) { /* Bcc, BRA, BSR */
+	disp=(uae_s8)opcode;
+	len=2;
+	if (disp==0) {
+	    disp=(uae_s16)do_get_mem_word(pc+1);
+	    len=4;
+	}
+	else if (disp==-1) {
+	    disp=(uae_s32)do_get_mem_long((uae_u32*)(pc+1));
+	    len=6;
+	}
+	succ[0]=(uintptr)pc+2+disp;
+	if ((opcode&0x0e00)==0) /* BRA, BSR */
+	    return 1;
+	succ[1]=(uintptr)pc+len;
+	return 2;
+    }
+    if ((opcode&0xf0f8)==0x50c8) { /* DBcc */
+	succ[0]=(uintptr)pc+2+(uae_s16)do_get_mem_word(pc+1);
+	succ[1]=(uintptr)pc+4;
+	return 2;
+    }
+    return 0;
+}
+
+/* Remember how a block that lies all in ROM was translated, so that the
+   next run can translate it again right away. The record holds the
+   optimization level, the number of instructions, the ROM offset the
+   block went on to (or ~0) and the ROM offsets of the instructions */
+static void rom_cache_record(blockinfo* bi, cpu_history* pc_hist, int blocklen, uae_u8* exit_pc_p)
+{
+    uae_u32* trace;
+    int i;
+
+    for (i=0;i<blocklen;i++) {
+	if (!isinrom((uintptr)pc_hist[i].location)) {
+	    free(bi->rom_trace);
+	    bi->rom_trace=NULL;
+	    return;
+	}
+    }
+    trace=(uae_u32*)realloc(bi->rom_trace,(3+blocklen)*sizeof(uae_u32));
+    if (!trace)
+	return;
+    trace[0]=optlev;
+    trace[1]=blocklen;
+    trace[2]=isinrom((uintptr)exit_pc_p) ? exit_pc_p-ROMBaseHost : 0xffffffff;
+    for (i=0;i<blocklen;i++)
+	trace[3+i]=(uae_u8*)pc_hist[i].location-ROMBaseHost;
+    bi->rom_trace=trace;
+}
+
+/* Exit of a block whose new PC is in native register r. If the PC is the
+   predicted one, go straight on to that block, otherwise fall through.
+   The prediction is where the block went on to when last interpreted
+   (exit_pc_p), for returns as well as for jumps */
+static void predict_indirect_exit(blockinfo* bi, int r, uae_u8* exit_pc_p)
+{
+    /* Inline cache, the jump is adjusted like any other to the
+       target's handler as it changes */
+    uae_u32 v=(uae_u32)(uintptr)exit_pc_p;
+    uae_u32* branchadd;
+    uae_u32* tba;
+    bigstate tmp;
+    blockinfo* tbi;
+
+    tmp=live;
+    raw_cmp_l_ri(r,v);
+    raw_jnz_l_oponly();
+    branchadd=(uae_u32*)get_target();
+    emit_long(0);
+    tbi=get_blockinfo_addr_new((void*)exit_pc_p,1);
+    match_states(tbi);
+    raw_cmp_l_mi((uintptr)&regs.spcflags,0);
+    raw_jcc_l_oponly(4);
+    tba=(uae_u32*)get_target();
+    emit_long(get_matched_handler(tbi)-((uintptr)tba+4));
+    raw_mov_l_mi((uintptr)&regs.pc_p,v);
+    raw_jmp((uintptr)popall_do_nothing);
+    create_jmpdep(bi,0,tba,v);
+    *branchadd=(uintptr)get_target()-((uintptr)branchadd+4);
+    live=tmp;
+}
+
+static void compile_block(cpu_history* pc_hist, int blocklen, uae_u8* exit_pc_p)
 {
     if (letit && compiled_code) {
-#if PROFILE_COMPILE_TIME
 	compile_count++;
 	clock_t start_time = clock();
-#endif
 #if JIT_DEBUG
 	bool disasm_block = false;
 #endif
 	
 	/* OK, here we need to 'compile' a block */
-	int i;
+	int i,j;
 	int r;
 	int was_comp=0;
 	uae_u8 liveflags[MAXRUN+1];
@@ -6616,11 +7520,13 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 	void* specflags=(void*)&regs.spcflags;
 	blockinfo* bi=NULL;
 	blockinfo* bi2;
+#if !USE_CHECKSUM_INFO
 	int extra_len=0;
+#endif
 
 	redo_current_block=0;
 	if (current_compile_p>=max_compile_start)
-	    flush_icache_hard(7);
+	    flush_icache_segment(7);
 
 	alloc_blockinfos();
 
@@ -6653,22 +7559,39 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 	current_block_pc_p=(uintptr)pc_hist[0].location;
 	
 	remove_deps(bi); /* We are about to create new code */
+	for (j=0;j<2;j++) {
+	    bi->dep[j].jmp_off=NULL;
+	    bi->dep[j].target=NULL;
+	}
 	bi->optlevel=optlev;
 	bi->pc_p=(uae_u8*)pc_hist[0].location;
 #if USE_CHECKSUM_INFO
+	unindex_block_ranges(bi);
 	free_checksum_info_chain(bi->csi);
 	bi->csi = NULL;
 #endif
-	
-	liveflags[blocklen]=0x1f; /* All flags needed afterwards */
+
+	/* The flags needed afterwards are those the blocks we go on to read */
+	uintptr succ[2];
+	uae_u8 succ_flags[2];
+	blockinfo* succ_bi[2]={NULL,NULL};
+	uae_u8 succ_needed[2];
+	int n_succ=0;
+	int self_loop=0;
+#if USE_CHECKSUM_INFO
+	if (optlev>1 && end_block(DO_GET_OPCODE(pc_hist[blocklen-1].location)))
+	    n_succ=block_successors(pc_hist[blocklen-1].location,succ);
+#endif
+
 	i=blocklen;
 	while (i--) {
 	    uae_u16* currpcp=pc_hist[i].location;
-	    uae_u32 op=DO_GET_OPCODE(currpcp);
 
 #if USE_CHECKSUM_INFO
 		trace_in_rom = trace_in_rom && isinrom((uintptr)currpcp);
-		if (follow_const_jumps && is_const_jump(op)) {
+		uae_u32 op=DO_GET_OPCODE(currpcp);
+		if ((follow_const_jumps && is_const_jump(op)) ||
+			(i < blocklen - 1 && end_block(op))) {
 			checksum_info *csi = alloc_checksum_info();
 			csi->start_p = (uae_u8 *)min_pcp;
 			csi->length = max_pcp - min_pcp + LONGEST_68K_INST;
@@ -6683,22 +7606,81 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 	    if ((uintptr)currpcp>max_pcp)
 		max_pcp=(uintptr)currpcp;
 #endif
-
-		liveflags[i]=((liveflags[i+1]&
-			       (~prop[op].set_flags))|
-			      prop[op].use_flags);
-		if (prop[op].is_addx && (liveflags[i+1]&FLAG_Z)==0)
-		    liveflags[i]&= ~FLAG_Z;
 	}
 
 #if USE_CHECKSUM_INFO
+	for (j=0;j<n_succ;j++) {
+	    succ_flags[j]=0x1f;
+	    if (succ[j]==current_block_pc_p) {
+		self_loop=1;
+		continue;
+	    }
+	    if (!isincode(succ[j]))
+		continue;
+	    /* The first instruction there is covered by our checksum */
+	    uae_u32 op=DO_GET_OPCODE(succ[j]);
+	    succ_flags[j]=(0x1f&~prop[op].set_flags)|prop[op].use_flags;
+	    checksum_info *csi = alloc_checksum_info();
+	    csi->start_p = (uae_u8 *)succ[j];
+	    csi->length = LONGEST_68K_INST;
+	    csi->next = bi->csi;
+	    bi->csi = csi;
+	    trace_in_rom = trace_in_rom && isinrom(succ[j]);
+	    /* A block translated from there tells when it changes, see
+	       flush_flag_callers() */
+	    blockinfo* tbi=get_blockinfo_addr((void*)succ[j]);
+	    if (tbi && tbi!=bi && tbi->status==BI_ACTIVE && bi->flagdeps!=2) {
+		succ_flags[j]&=tbi->needed_flags;
+		succ_bi[j]=tbi;
+		succ_needed[j]=tbi->needed_flags;
+	    }
+	}
+	if (bi->flagdeps!=2)
+	    bi->flagdeps=(succ_bi[0] || succ_bi[1]);
+
 	checksum_info *csi = alloc_checksum_info();
 	csi->start_p = (uae_u8 *)min_pcp;
 	csi->length = max_pcp - min_pcp + LONGEST_68K_INST;
 	csi->next = bi->csi;
 	bi->csi = csi;
+	index_block_ranges(bi);
+	if (smc_protect)
+		smc_protect_block(bi);
+#if USE_COMPILE_THREAD
+	/* The emulation thread keeps running while we translate and may write
+	   the code: a checksum taken before liveness analysis and translation
+	   is compared with the final one */
+	uae_u32 c1_pre = 0, c2_pre = 0;
+	if (compiling_in_thread && !trace_in_rom)
+	    calc_checksum(bi,&c1_pre,&c2_pre);
+#endif
 #endif
 
+	/* A loop back to the start needs what the block needs: iterate from
+	   nothing up to a fixed point */
+	uae_u8 self_flags=0;
+	for (;;) {
+	    liveflags[blocklen]=n_succ ? 0 : 0x1f;
+	    for (j=0;j<n_succ;j++)
+		liveflags[blocklen]|=(succ[j]==current_block_pc_p) ? self_flags : succ_flags[j];
+	    i=blocklen;
+	    while (i--) {
+		uae_u32 op=DO_GET_OPCODE(pc_hist[i].location);
+		if (i < blocklen - 1 && end_block(op))
+		    liveflags[i+1]=0x1f; /* Side exit of a trace, flags are needed there */
+		liveflags[i]=((liveflags[i+1]&
+			       (~prop[op].set_flags))|
+			      prop[op].use_flags);
+		if (prop[op].is_addx && (liveflags[i+1]&FLAG_Z)==0)
+		    liveflags[i]&= ~FLAG_Z;
+	    }
+	    if (!self_loop || (liveflags[0]&~self_flags)==0)
+		break;
+	    self_flags|=liveflags[0];
+	}
+
+	if (bi->needed_flags!=0xff && (liveflags[0]&~bi->needed_flags))
+	    flush_flag_callers(bi,1); /* They assumed we need less */
 	bi->needed_flags=liveflags[0];
 
 	align_target(align_loops);
@@ -6710,6 +7692,25 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 	current_block_start_target=(uintptr)get_target();
 	
 	log_startblock();
+
+	/* Load the pinned registers. Blocks that already have them at home
+	   jump past this */
+	bi->env=default_ss;
+	bi->havestate=0;
+#if USE_PINNED_REGS
+	if (optlev>1) {
+	    ra_plan(pc_hist,blocklen,&(bi->env));
+	    for (r=0;r<N_REGS;r++) {
+		if (bi->env.nat[r]>=0) {
+		    raw_mov_l_rm(r,(uintptr)&regs.regs[bi->env.nat[r]]);
+		    bi->havestate=1;
+		}
+	    }
+	}
+#endif
+	bi->direct_pinned=(cpuop_func *)get_target();
+	if (jit_profile)
+	    raw_add_l_mi((uintptr)&(bi->exec_count),1);
 	
 	if (bi->count>=0) { /* Need to generate countdown code */
 	    raw_mov_l_mi((uintptr)&regs.pc_p,(uintptr)pc_hist[0].location);
@@ -6730,14 +7731,29 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 	    comp_pc_p=(uae_u8*)pc_hist[0].location;
 	    init_comp();
 	    was_comp=1;
+	    for (r=0;r<N_REGS;r++) {
+		int v=bi->env.nat[r];
+		if (v>=0) {
+		    live.state[v].realreg=r;
+		    live.state[v].realind=0;
+		    live.state[v].validsize=4;
+		    live.state[v].dirtysize=0;
+		    set_status(v,CLEAN);
+		    live.nat[r].holds[0]=v;
+		    live.nat[r].nholds=1;
+		    live.nat[r].touched=touchcnt++;
+		}
+	    }
 
-#ifdef USE_CPU_EMUL_SERVICES
-	    raw_sub_l_mi((uintptr)&emulated_ticks,blocklen);
-	    raw_jcc_b_oponly(NATIVE_CC_GT);
-	    uae_s8 *branchadd=(uae_s8*)get_target();
-	    emit_byte(0);
-	    raw_call((uintptr)cpu_do_check_ticks);
-	    *branchadd=(uintptr)get_target()-((uintptr)branchadd+1);
+#ifdef USE_CPU_EMUL_TICKS
+	    if (cpu_count_ticks) {
+		raw_sub_l_mi((uintptr)&emulated_ticks,blocklen);
+		raw_jcc_b_oponly(NATIVE_CC_GT);
+		uae_s8 *branchadd=(uae_s8*)get_target();
+		emit_byte(0);
+		raw_call((uintptr)cpu_do_check_ticks);
+		*branchadd=(uintptr)get_target()-((uintptr)branchadd+1);
+	    }
 #endif
 
 #if JIT_DEBUG
@@ -6752,6 +7768,9 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 		cpuop_func **cputbl;
 		compop_func **comptbl;
 		uae_u32 opcode=DO_GET_OPCODE(pc_hist[i].location);
+#if USE_PINNED_REGS
+		ra_set_pos(i);
+#endif
 		needed_flags=(liveflags[i+1] & prop[opcode].set_flags);
 		if (!needed_flags) {
 		    cputbl=nfcpufunctbl;
@@ -6810,10 +7829,18 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 		    raw_mov_l_mi((uintptr)&regs.pc_p,
 				 (uintptr)pc_hist[i].location);
 		    raw_call((uintptr)cputbl[opcode]);
-#if PROFILE_UNTRANSLATED_INSNS
+		    if (jit_profile) {
 			// raw_cputbl_count[] is indexed with plain opcode (in m68k order)
 			raw_add_l_mi((uintptr)&raw_cputbl_count[cft_map(opcode)],1);
-#endif
+		    }
+		    switch (table68k[cft_map(opcode)].mnemo) {
+		    case i_FPP: case i_FDBcc: case i_FScc: case i_FTRAPcc:
+		    case i_FBcc: case i_FSAVE: case i_FRESTORE:
+			untranslated_fpu_count++;
+			break;
+		    default:
+			break;
+		    }
 #if USE_NORMAL_CALLING_CONVENTION
 		    raw_inc_sp(4);
 #endif
@@ -6830,9 +7857,45 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 			*branchadd=(uintptr)get_target()-(uintptr)branchadd-1;
 		    }
 		}
+
+		if (i < blocklen - 1 && end_block(opcode)) {
+		    /* A trace goes on with the recorded outcome of the branch */
+		    uintptr followed=(uintptr)pc_hist[i+1].location;
+		    if (failure) {
+			raw_cmp_l_mi((uintptr)&regs.pc_p,followed);
+			raw_jnz((uintptr)popall_do_nothing);
+		    }
+		    else if (next_pc_p && taken_pc_p!=next_pc_p) {
+			/* Side exit to the dispatcher for the other outcome */
+			uintptr exit_pc=(followed==next_pc_p) ? taken_pc_p : next_pc_p;
+			int cc=(followed==next_pc_p) ? branch_cc^1 : branch_cc;
+			uae_u32* branchadd;
+			bigstate tmp;
+
+			raw_jcc_l_oponly(cc);
+			branchadd=(uae_u32*)get_target();
+			emit_long(0);
+			tmp=live;
+			flush(1);
+			raw_mov_l_mi((uintptr)&regs.pc_p,exit_pc);
+			flush_reg_count();
+			raw_jmp((uintptr)popall_do_nothing);
+			*branchadd=(uintptr)get_target()-((uintptr)branchadd+4);
+			live=tmp;
+		    }
+		    if (!failure) {
+			mov_l_ri(PC_P,followed);
+			comp_pc_p=(uae_u8*)followed;
+		    }
+		    next_pc_p=0;
+		    taken_pc_p=0;
+		    branch_cc=0;
+		}
 	    }
-#if 1 /* This isn't completely kosher yet; It really needs to be
-	 be integrated into a general inter-block-dependency scheme */
+#if !USE_CHECKSUM_INFO /* This isn't completely kosher yet; It really
+			  needs to be be integrated into a general
+			  inter-block-dependency scheme, as with the
+			  flags computed from the successors above */
 	    if (next_pc_p && taken_pc_p &&
 		was_comp && taken_pc_p==current_block_pc_p) {
 		blockinfo* bi1=get_blockinfo_addr_new((void*)next_pc_p,0);
@@ -6859,6 +7922,9 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 	    }
 #endif
 		log_flush();
+#if USE_PINNED_REGS
+	    ra_set_pos(blocklen);
+#endif
 
 	    if (next_pc_p) { /* A branch was registered */
 		uintptr t1=next_pc_p;
@@ -6890,7 +7956,7 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 		raw_cmp_l_mi((uintptr)specflags,0);
 		raw_jcc_l_oponly(4);
 		tba=(uae_u32*)get_target();
-		emit_long(get_handler(t1)-((uintptr)tba+4));
+		emit_long(get_matched_handler(tbi)-((uintptr)tba+4));
 		raw_mov_l_mi((uintptr)&regs.pc_p,t1);
 		flush_reg_count();
 		raw_jmp((uintptr)popall_do_nothing);
@@ -6907,7 +7973,7 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 		raw_cmp_l_mi((uintptr)specflags,0);
 		raw_jcc_l_oponly(4);
 		tba=(uae_u32*)get_target();
-		emit_long(get_handler(t2)-((uintptr)tba+4));
+		emit_long(get_matched_handler(tbi)-((uintptr)tba+4));
 		raw_mov_l_mi((uintptr)&regs.pc_p,t2);
 		flush_reg_count();
 		raw_jmp((uintptr)popall_do_nothing);
@@ -6923,12 +7989,16 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 		/* Let's find out where next_handler is... */
 		if (was_comp && isinreg(PC_P)) { 
 		    r=live.state[PC_P].realreg;
-			raw_and_l_ri(r,TAGMASK);
-			int r2 = (r==0) ? 1 : 0;
-			raw_mov_l_ri(r2,(uintptr)popall_do_nothing);
-			raw_cmp_l_mi((uintptr)specflags,0);
-			raw_cmov_l_rm_indexed(r2,(uintptr)cache_tags,r,SIZEOF_VOID_P,NATIVE_CC_EQ);
-			raw_jmp_r(r2);
+		    if (predict_branches && exit_pc_p)
+			predict_indirect_exit(bi,r,exit_pc_p);
+		    raw_and_l_ri(r,TAGMASK);
+		    int r2 = (r==0) ? 1 : 0;
+		    int r3 = (r==2 || r2==2) ? 3 : 2;
+		    raw_mov_p_ri(r2,(uintptr)popall_do_nothing);
+		    raw_mov_p_ri(r3,(uintptr)cache_tags);
+		    raw_cmp_l_mi((uintptr)specflags,0);
+		    raw_cmov_p_rrm_indexed(r2,r3,r,SIZEOF_VOID_P,NATIVE_CC_EQ);
+		    raw_jmp_r(r2);
 		}
 		else if (was_comp && isconst(PC_P)) {
 		    uae_u32 v=live.state[PC_P].val;
@@ -6938,10 +8008,10 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 		    tbi=get_blockinfo_addr_new((void*)(uintptr)v,1);
 		    match_states(tbi);
 
-			raw_cmp_l_mi((uintptr)specflags,0);
-			raw_jcc_l_oponly(4);
+		    raw_cmp_l_mi((uintptr)specflags,0);
+		    raw_jcc_l_oponly(4);
 		    tba=(uae_u32*)get_target();
-		    emit_long(get_handler(v)-((uintptr)tba+4));
+		    emit_long(get_matched_handler(tbi)-((uintptr)tba+4));
 		    raw_mov_l_mi((uintptr)&regs.pc_p,v);
 		    raw_jmp((uintptr)popall_do_nothing);
 		    create_jmpdep(bi,0,tba,v);
@@ -6949,16 +8019,43 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 		else {
 		    r=REG_PC_TMP;
 		    raw_mov_l_rm(r,(uintptr)&regs.pc_p);
-			raw_and_l_ri(r,TAGMASK);
-			int r2 = (r==0) ? 1 : 0;
-			raw_mov_l_ri(r2,(uintptr)popall_do_nothing);
-			raw_cmp_l_mi((uintptr)specflags,0);
-			raw_cmov_l_rm_indexed(r2,(uintptr)cache_tags,r,SIZEOF_VOID_P,NATIVE_CC_EQ);
-			raw_jmp_r(r2);
+		    raw_and_l_ri(r,TAGMASK);
+		    int r2 = (r==0) ? 1 : 0;
+		    int r3 = (r==2 || r2==2) ? 3 : 2;
+		    raw_mov_p_ri(r2,(uintptr)popall_do_nothing);
+		    raw_mov_p_ri(r3,(uintptr)cache_tags);
+		    raw_cmp_l_mi((uintptr)specflags,0);
+		    raw_cmov_p_rrm_indexed(r2,r3,r,SIZEOF_VOID_P,NATIVE_CC_EQ);
+		    raw_jmp_r(r2);
 		}
 	    }
 	}
 
+#if USE_CHECKSUM_INFO
+	/* The blocks whose flags we relied on must know about us. A jump to
+	   them links us already, otherwise we add a plain dependency */
+	for (j=0;j<n_succ;j++) {
+	    blockinfo* tbi=succ_bi[j];
+	    int k;
+
+	    if (!tbi || bi->dep[0].target==tbi || bi->dep[1].target==tbi)
+		continue;
+	    for (k=0;k<2 && bi->dep[k].target;k++)
+		;
+	    if (k<2)
+		create_jmpdep(bi,k,NULL,(uintptr)tbi->pc_p);
+	    else {
+		bi->flagdeps=2; /* Don't rely on them next time */
+		redo_current_block=1;
+	    }
+	}
+	for (j=0;j<n_succ;j++) {
+	    blockinfo* tbi=succ_bi[j];
+	    if (tbi && (tbi->status!=BI_ACTIVE || tbi->needed_flags!=succ_needed[j]))
+		redo_current_block=1; /* Changed while we were translating */
+	}
+#endif
+
 #if USE_MATCH	
 	if (callers_need_recompile(&live,&(bi->env))) {
 	    mark_callers_recompile(bi);
@@ -6977,6 +8074,10 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 	}
 	else {
 	    calc_checksum(bi,&(bi->c1),&(bi->c2));
+#if USE_COMPILE_THREAD
+	    if (compiling_in_thread && (bi->c1!=c1_pre || bi->c2!=c2_pre))
+		bi->c1=bi->c2=0;  /* Changed under us, never matches */
+#endif
 		add_to_active(bi);
 	}
 #else
@@ -7033,28 +8134,145 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 	match_states(bi);
 	flush(1);
 
-	raw_jmp((uintptr)bi->direct_handler);
+	raw_jmp(get_matched_handler(bi));
 
 	current_compile_p=get_target();
 	raise_in_cl_list(bi);
 	
-	/* We will flush soon, anyway, so let's do it now */
-	if (current_compile_p>=max_compile_start)
-		flush_icache_hard(7);
-	
 	bi->status=BI_ACTIVE;
 	if (redo_current_block)
 	    block_need_recompile(bi);
+
+	clock_t t=clock()-start_time;
+	compile_time+=t;
+	if (jit_profile) {
+	    bi->compile_clock+=t;
+	    perf_map_block(bi,(uae_u8*)current_block_start_target,current_compile_p);
+	}
+	if (rom_cache_path && optlev>0)
+	    rom_cache_record(bi,pc_hist,blocklen,exit_pc_p);
 	
-#if PROFILE_COMPILE_TIME
-	compile_time += (clock() - start_time);
-#endif
-    }
+	/* We will flush soon, anyway, so let's do it now */
+	if (current_compile_p>=max_compile_start)
+		flush_icache_segment(7);
+    }
+}
+
+#if USE_COMPILE_THREAD
+/* Translation of hot blocks in a separate thread. While a trace is being
+   compiled, the emulation thread only interprets and leaves all compiler
+   data alone, so the compiler itself needs no locking: anything that
+   would touch it (flushes) first waits for the translation to complete.
+   The block is installed into cache_tags by compile_block() as usual and
+   is picked up once the emulation thread gets back to compiled code. */
+static pthread_t compile_thread;
+static pthread_mutex_t compile_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t compile_cond = PTHREAD_COND_INITIALIZER;
+static cpu_history compile_hist[MAXRUN];
+static uae_u8* compile_exit_pc_p;
+static volatile int compile_len = 0;	// Length of the trace being compiled, 0 when done
+static bool compile_pending = false;	// Emulation thread side: translation not picked up yet
+static bool compile_thread_quit = false;
+static uae_u32 thread_compile_count = 0;
+static void (*flush_icache_unlocked)(int n) = flush_icache_none;
+
+static void *compile_thread_func(void *arg)
+{
+	pthread_mutex_lock(&compile_lock);
+	for (;;) {
+		while (compile_len == 0 && !compile_thread_quit)
+			pthread_cond_wait(&compile_cond, &compile_lock);
+		if (compile_thread_quit)
+			break;
+		pthread_mutex_unlock(&compile_lock);
+
+		compiling_in_thread = true;
+		compile_block(compile_hist, compile_len, compile_exit_pc_p);
+		compiling_in_thread = false;
+		thread_compile_count++;
+
+		pthread_mutex_lock(&compile_lock);
+		compile_len = 0;
+		pthread_cond_broadcast(&compile_cond);
+	}
+	pthread_mutex_unlock(&compile_lock);
+	return NULL;
+}
+
+static void flush_icache_sync(int n)
+{
+	compile_thread_wait();
+	flush_icache_unlocked(n);
+}
+
+static bool compile_thread_init(void)
+{
+	compile_thread_quit = false;
+	if (pthread_create(&compile_thread, NULL, compile_thread_func, NULL) != 0)
+		return false;
+	// Flushes from the interpreter must wait for the translation in progress
+	flush_icache_unlocked = flush_icache;
+	flush_icache = flush_icache_sync;
+	return true;
+}
+
+static void compile_thread_exit(void)
+{
+	pthread_mutex_lock(&compile_lock);
+	compile_thread_quit = true;
+	pthread_cond_broadcast(&compile_cond);
+	pthread_mutex_unlock(&compile_lock);
+	pthread_join(compile_thread, NULL);
+	write_log("<JIT compiler> : blocks translated in a separate thread : %u\n", thread_compile_count);
+}
 
-    /* Account for compilation time */
-    cpu_do_check_ticks();
+static void compile_thread_submit(cpu_history *pc_hist, int blocklen)
+{
+	pthread_mutex_lock(&compile_lock);
+	memcpy(compile_hist, pc_hist, blocklen * sizeof(cpu_history));
+	compile_exit_pc_p = regs.pc_p;
+	compile_len = blocklen;
+	compile_pending = true;
+	pthread_cond_signal(&compile_cond);
+	pthread_mutex_unlock(&compile_lock);
 }
 
+/* Wait for the translation in progress, if any, and make it visible to
+   the emulation thread */
+static void compile_thread_wait(void)
+{
+	if (!compile_pending)
+		return;
+	pthread_mutex_lock(&compile_lock);
+	while (compile_len)
+		pthread_cond_wait(&compile_cond, &compile_lock);
+	pthread_mutex_unlock(&compile_lock);
+	compile_pending = false;
+}
+
+/* Interpret until the translation in progress is complete. Returns true if
+   the caller must return, like m68k_do_specialties() */
+static bool execute_while_compiling(void)
+{
+	while (compile_len) {
+		uae_u32 opcode = GET_OPCODE;
+#if FLIGHT_RECORDER
+		m68k_record_step(m68k_getpc());
+#endif
+		(*cpufunctbl[opcode])(opcode);
+		cpu_check_ticks();
+		if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN)) {
+			if (m68k_do_specialties()) {
+				compile_thread_wait();
+				return true;
+			}
+		}
+	}
+	compile_thread_wait();
+	return false;
+}
+#endif
+
 void do_nothing(void)
 {
     /* What did you expect this to do? */
@@ -7075,11 +8293,34 @@ void exec_nostats(void)
 	}
 }
 
+/* Is the next translation of that block to be a trace? */
+static bool trace_due(blockinfo* bi)
+{
+	if (!bi)
+		return false;
+	if (bi->count!=-1)
+		return bi->optlevel>=TRACE_OPTLEVEL; /* Recompiling a trace */
+	int optlev=bi->optlevel+1;
+	while (!optcount[optlev])
+		optlev++;
+	return optlev>=TRACE_OPTLEVEL;
+}
+
 void execute_normal(void)
 {
+	if (jit_profile && time(NULL) - last_profile_report >= profile_report_interval) {
+#if USE_COMPILE_THREAD
+		compile_thread_wait();
+#endif
+		last_profile_report = time(NULL);
+		jit_profile_report();
+	}
 	if (!check_for_cache_miss()) {
 		cpu_history pc_hist[MAXRUN];
 		int blocklen = 0;
+		/* A trace follows conditional branches the way they go now and
+		   stops at other branches, or once it loops back to its start */
+		int trace_branches = trace_due(get_blockinfo_addr(regs.pc_p)) ? MAX_TRACE_BRANCHES : 0;
 #if REAL_ADDRESSING || DIRECT_ADDRESSING
 		start_pc_p = regs.pc_p;
 		start_pc = get_virtual_address(regs.pc_p);
@@ -7095,8 +8336,25 @@ void execute_normal(void)
 #endif
 			(*cpufunctbl[opcode])(opcode);
 			cpu_check_ticks();
-			if (end_block(opcode) || SPCFLAGS_TEST(SPCFLAG_ALL) || blocklen>=MAXRUN) {
-				compile_block(pc_hist, blocklen);
+			const bool followed = trace_branches > 0 && trace_through(opcode) &&
+				(blocklen < MIN_TRACE_LOOP || (uae_u16 *)regs.pc_p != pc_hist[0].location);
+			if (followed)
+				trace_branches--;
+			if ((end_block(opcode) && !followed) || SPCFLAGS_TEST(SPCFLAG_ALL) || blocklen>=MAXRUN) {
+#if USE_COMPILE_THREAD
+				/* Only hand over traces that are due for actual translation,
+				   countdown stubs are quicker to emit than to pass around */
+				if (compile_thread_active) {
+					blockinfo* bi=get_blockinfo_addr(pc_hist[0].location);
+					if (bi && bi->count==-1) {
+						compile_thread_submit(pc_hist, blocklen);
+						return;
+					}
+				}
+#endif
+				compile_block(pc_hist, blocklen, regs.pc_p);
+				/* Account for compilation time */
+				cpu_do_check_ticks();
 				return; /* We will deal with the spcflags in the caller */
 			}
 			/* No need to check regs.spcflags, because if they were set,
@@ -7110,6 +8368,14 @@ typedef void (*compiled_handler)(void);
 static void m68k_do_compile_execute(void)
 {
 	for (;;) {
+#if USE_COMPILE_THREAD
+		if (compile_pending && execute_while_compiling())
+			return;
+#endif
+#if USE_CHECKSUM_INFO
+		if (smc_pages_written)
+			smc_flush_written_pages();
+#endif
 		((compiled_handler)(pushall_call_handler))();
 		/* Whenever we return from that, we should check spcflags */
 		if (SPCFLAGS_TEST(SPCFLAG_ALL)) {
@@ -7119,8 +8385,134 @@ static void m68k_do_compile_execute(void)
 	}
 }
 
+/* ROM translations are kept as the traces they were made from rather
+   than as host code: that is full of host addresses which change from
+   one run to the next. Translating them again is what the blocks they
+   link to need anyway, and it still saves interpreting the ROM code
+   until it gets hot. The file is only good for the same ROM, patched
+   the same way, and for the same emulator build and settings */
+struct rom_cache_header {
+	char magic[8];
+	uae_u32 version;
+	uae_u32 rom_checksum;	// From the ROM header
+	uae_u32 rom_hash;		// Of the ROM as patched
+	uae_u32 build_id;
+	uae_u32 cpu_type;
+	uae_u32 fpu_type;
+	uae_u32 options;		// JIT settings that change translations
+	uae_u32 count;			// Number of records that follow
+};
+
+static uae_u32 rom_cache_hash(const uae_u8 *p, uae_u32 size, uae_u32 h)
+{
+	while (size--)
+		h = (h ^ *p++) * 16777619;	// FNV-1a
+	return h;
+}
+
+static void rom_cache_key(rom_cache_header *h)
+{
+	static const char build[] = __DATE__ " " __TIME__;
+
+	memset(h, 0, sizeof(*h));
+	memcpy(h->magic, "B2JITROM", 8);
+	h->version = 1;
+	h->rom_checksum = ReadMacInt32(ROMBaseMac);
+	h->rom_hash = rom_cache_hash(ROMBaseHost, ROMSize, 2166136261U);
+	h->build_id = rom_cache_hash((const uae_u8 *)build, sizeof(build), 2166136261U);
+	h->cpu_type = CPUType;
+	h->fpu_type = FPUType;
+	h->options = (follow_const_jumps ? 1 : 0) | (avoid_fpu ? 0 : 2) |
+		(optcount[TRACE_OPTLEVEL - 1] > 0 ? 4 : 0) | (predict_branches ? 8 : 0) |
+		(jit_profile ? 16 : 0);
+}
+
+static void rom_cache_save(void)
+{
+	char tmp_path[1024];
+	snprintf(tmp_path, sizeof(tmp_path), "%s.%d", rom_cache_path, (int)getpid());
+	FILE *f = fopen(tmp_path, "wb");
+	if (f == NULL) {
+		write_log("<JIT compiler> : could not write ROM translations to %s\n", tmp_path);
+		return;
+	}
+
+	rom_cache_header h;
+	rom_cache_key(&h);
+	bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+	for (int l = 0; l < 2; l++) {
+		for (blockinfo *bi = l ? dormant : active; bi && ok; bi = bi->next) {
+			if (bi->rom_trace) {
+				ok = fwrite(bi->rom_trace, sizeof(uae_u32), 3 + bi->rom_trace[1], f) == 3 + bi->rom_trace[1];
+				h.count++;
+			}
+		}
+	}
+	rewind(f);
+	ok = ok && fwrite(&h, sizeof(h), 1, f) == 1;
+	if (fclose(f) != 0 || !ok || rename(tmp_path, rom_cache_path) != 0) {
+		write_log("<JIT compiler> : could not write ROM translations to %s\n", rom_cache_path);
+		unlink(tmp_path);
+		return;
+	}
+	write_log("<JIT compiler> : saved %u ROM translations to %s\n", h.count, rom_cache_path);
+}
+
+static void rom_cache_load(void)
+{
+	FILE *f = fopen(rom_cache_path, "rb");
+	if (f == NULL)
+		return;
+
+	rom_cache_header h, key;
+	rom_cache_key(&key);
+	if (fread(&h, sizeof(h), 1, f) != 1 || memcmp(&h, &key, offsetof(rom_cache_header, count)) != 0) {
+		write_log("<JIT compiler> : ROM translations in %s are for another setup, ignored\n", rom_cache_path);
+		fclose(f);
+		return;
+	}
+
+	// Stop once the translation cache is full, flushing would only throw them away
+	const int flushes = hard_flush_count + soft_flush_count + segment_flush_count;
+	cpu_history pc_hist[MAXRUN];
+	uae_u32 ofs[MAXRUN];
+	uae_u32 n = 0;
+	for (uae_u32 i = 0; i < h.count; i++) {
+		uae_u32 rec[3];
+		if (fread(rec, sizeof(uae_u32), 3, f) != 3 || rec[0] == 0 || rec[0] >= 10 ||
+			rec[1] == 0 || rec[1] > MAXRUN || fread(ofs, sizeof(uae_u32), rec[1], f) != rec[1])
+			break;
+		bool ok = true;
+		for (uae_u32 j = 0; j < rec[1]; j++) {
+			ok = ok && ofs[j] < ROMSize && !(ofs[j] & 1);
+			pc_hist[j].location = (uae_u16 *)(ROMBaseHost + ofs[j]);
+		}
+		if (!ok || hard_flush_count + soft_flush_count + segment_flush_count != flushes)
+			break;
+
+		alloc_blockinfos();
+		blockinfo *bi = get_blockinfo_addr_new(pc_hist[0].location, 0);
+		if (bi->status != BI_INVALID)
+			continue;
+		bi->optlevel = rec[0] - 1;	// compile_block() goes on to the next level
+		bi->count = -1;
+		start_pc_p = (uae_u8 *)pc_hist[0].location;
+		start_pc = get_virtual_address(start_pc_p);
+		compile_block(pc_hist, rec[1], rec[2] < ROMSize ? ROMBaseHost + rec[2] : NULL);
+		n++;
+	}
+	fclose(f);
+	write_log("<JIT compiler> : translated %u blocks from %s\n", n, rom_cache_path);
+}
+
 void m68k_compile_execute (void)
 {
+	static bool rom_cache_loaded = false;
+	if (rom_cache_path && !rom_cache_loaded) {
+		rom_cache_loaded = true;
+		rom_cache_load();
+	}
+
     for (;;) {
 	  if (quit_program)
 		break;
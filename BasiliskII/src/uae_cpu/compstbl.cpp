@@ -1808,32 +1808,32 @@ struct comptbl op_smalltbl_0_comp_ff[] = {
 { NULL, 0x00000000, 61424 }, /* BFINS.L #<data>.W,(d8,An,Xn) */
 { NULL, 0x00000000, 61432 }, /* BFINS.L #<data>.W,(xxx).W */
 { NULL, 0x00000000, 61433 }, /* BFINS.L #<data>.W,(xxx).L */
-{ NULL, 0x00000020, 61952 }, /* FPP.L #<data>.W,Dn */
-{ NULL, 0x00000020, 61960 }, /* FPP.L #<data>.W,An */
-{ NULL, 0x00000020, 61968 }, /* FPP.L #<data>.W,(An) */
-{ NULL, 0x00000020, 61976 }, /* FPP.L #<data>.W,(An)+ */
-{ NULL, 0x00000020, 61984 }, /* FPP.L #<data>.W,-(An) */
-{ NULL, 0x00000020, 61992 }, /* FPP.L #<data>.W,(d16,An) */
-{ NULL, 0x00000020, 62000 }, /* FPP.L #<data>.W,(d8,An,Xn) */
-{ NULL, 0x00000020, 62008 }, /* FPP.L #<data>.W,(xxx).W */
-{ NULL, 0x00000020, 62009 }, /* FPP.L #<data>.W,(xxx).L */
-{ NULL, 0x00000020, 62010 }, /* FPP.L #<data>.W,(d16,PC) */
-{ NULL, 0x00000020, 62011 }, /* FPP.L #<data>.W,(d8,PC,Xn) */
-{ NULL, 0x00000020, 62012 }, /* FPP.L #<data>.W,#<data>.L */
-{ NULL, 0x00000020, 62016 }, /* FScc.L #<data>.W,Dn */
+{ op_f200_0_comp_ff, 0x00000022, 61952 }, /* FPP.L #<data>.W,Dn */
+{ op_f208_0_comp_ff, 0x00000022, 61960 }, /* FPP.L #<data>.W,An */
+{ op_f210_0_comp_ff, 0x00000022, 61968 }, /* FPP.L #<data>.W,(An) */
+{ op_f218_0_comp_ff, 0x00000022, 61976 }, /* FPP.L #<data>.W,(An)+ */
+{ op_f220_0_comp_ff, 0x00000022, 61984 }, /* FPP.L #<data>.W,-(An) */
+{ op_f228_0_comp_ff, 0x00000022, 61992 }, /* FPP.L #<data>.W,(d16,An) */
+{ op_f230_0_comp_ff, 0x00000022, 62000 }, /* FPP.L #<data>.W,(d8,An,Xn) */
+{ op_f238_0_comp_ff, 0x00000022, 62008 }, /* FPP.L #<data>.W,(xxx).W */
+{ op_f239_0_comp_ff, 0x00000022, 62009 }, /* FPP.L #<data>.W,(xxx).L */
+{ op_f23a_0_comp_ff, 0x00000022, 62010 }, /* FPP.L #<data>.W,(d16,PC) */
+{ op_f23b_0_comp_ff, 0x00000022, 62011 }, /* FPP.L #<data>.W,(d8,PC,Xn) */
+{ op_f23c_0_comp_ff, 0x00000022, 62012 }, /* FPP.L #<data>.W,#<data>.L */
+{ op_f240_0_comp_ff, 0x00000026, 62016 }, /* FScc.L #<data>.W,Dn */
 { NULL, 0x00000021, 62024 }, /* FDBcc.L #<data>.W,Dn */
-{ NULL, 0x00000020, 62032 }, /* FScc.L #<data>.W,(An) */
-{ NULL, 0x00000020, 62040 }, /* FScc.L #<data>.W,(An)+ */
-{ NULL, 0x00000020, 62048 }, /* FScc.L #<data>.W,-(An) */
-{ NULL, 0x00000020, 62056 }, /* FScc.L #<data>.W,(d16,An) */
-{ NULL, 0x00000020, 62064 }, /* FScc.L #<data>.W,(d8,An,Xn) */
-{ NULL, 0x00000020, 62072 }, /* FScc.L #<data>.W,(xxx).W */
-{ NULL, 0x00000020, 62073 }, /* FScc.L #<data>.W,(xxx).L */
+{ op_f250_0_comp_ff, 0x00000026, 62032 }, /* FScc.L #<data>.W,(An) */
+{ op_f258_0_comp_ff, 0x00000026, 62040 }, /* FScc.L #<data>.W,(An)+ */
+{ op_f260_0_comp_ff, 0x00000026, 62048 }, /* FScc.L #<data>.W,-(An) */
+{ op_f268_0_comp_ff, 0x00000026, 62056 }, /* FScc.L #<data>.W,(d16,An) */
+{ op_f270_0_comp_ff, 0x00000026, 62064 }, /* FScc.L #<data>.W,(d8,An,Xn) */
+{ op_f278_0_comp_ff, 0x00000026, 62072 }, /* FScc.L #<data>.W,(xxx).W */
+{ op_f279_0_comp_ff, 0x00000026, 62073 }, /* FScc.L #<data>.W,(xxx).L */
 { NULL, 0x00000021, 62074 }, /* FTRAPcc.L #<data>.W */
 { NULL, 0x00000021, 62075 }, /* FTRAPcc.L #<data>.L */
 { NULL, 0x00000021, 62076 }, /* FTRAPcc.L  */
-{ NULL, 0x00000021, 62080 }, /* FBcc.L #<data>,#<data>.W */
-{ NULL, 0x00000021, 62144 }, /* FBcc.L #<data>,#<data>.L */
+{ op_f280_0_comp_ff, 0x00000025, 62080 }, /* FBcc.L #<data>,#<data>.W */
+{ op_f2c0_0_comp_ff, 0x00000025, 62144 }, /* FBcc.L #<data>,#<data>.L */
 { NULL, 0x00000020, 62224 }, /* FSAVE.L (An) */
 { NULL, 0x00000020, 62240 }, /* FSAVE.L -(An) */
 { NULL, 0x00000020, 62248 }, /* FSAVE.L (d16,An) */
@@ -3678,32 +3678,32 @@ struct comptbl op_smalltbl_0_comp_nf[] = {
 { NULL, 0x00000000, 61424 }, /* BFINS.L #<data>.W,(d8,An,Xn) */
 { NULL, 0x00000000, 61432 }, /* BFINS.L #<data>.W,(xxx).W */
 { NULL, 0x00000000, 61433 }, /* BFINS.L #<data>.W,(xxx).L */
-{ NULL, 0x00000020, 61952 }, /* FPP.L #<data>.W,Dn */
-{ NULL, 0x00000020, 61960 }, /* FPP.L #<data>.W,An */
-{ NULL, 0x00000020, 61968 }, /* FPP.L #<data>.W,(An) */
-{ NULL, 0x00000020, 61976 }, /* FPP.L #<data>.W,(An)+ */
-{ NULL, 0x00000020, 61984 }, /* FPP.L #<data>.W,-(An) */
-{ NULL, 0x00000020, 61992 }, /* FPP.L #<data>.W,(d16,An) */
-{ NULL, 0x00000020, 62000 }, /* FPP.L #<data>.W,(d8,An,Xn) */
-{ NULL, 0x00000020, 62008 }, /* FPP.L #<data>.W,(xxx).W */
-{ NULL, 0x00000020, 62009 }, /* FPP.L #<data>.W,(xxx).L */
-{ NULL, 0x00000020, 62010 }, /* FPP.L #<data>.W,(d16,PC) */
-{ NULL, 0x00000020, 62011 }, /* FPP.L #<data>.W,(d8,PC,Xn) */
-{ NULL, 0x00000020, 62012 }, /* FPP.L #<data>.W,#<data>.L */
-{ NULL, 0x00000020, 62016 }, /* FScc.L #<data>.W,Dn */
+{ op_f200_0_comp_nf, 0x00000022, 61952 }, /* FPP.L #<data>.W,Dn */
+{ op_f208_0_comp_nf, 0x00000022, 61960 }, /* FPP.L #<data>.W,An */
+{ op_f210_0_comp_nf, 0x00000022, 61968 }, /* FPP.L #<data>.W,(An) */
+{ op_f218_0_comp_nf, 0x00000022, 61976 }, /* FPP.L #<data>.W,(An)+ */
+{ op_f220_0_comp_nf, 0x00000022, 61984 }, /* FPP.L #<data>.W,-(An) */
+{ op_f228_0_comp_nf, 0x00000022, 61992 }, /* FPP.L #<data>.W,(d16,An) */
+{ op_f230_0_comp_nf, 0x00000022, 62000 }, /* FPP.L #<data>.W,(d8,An,Xn) */
+{ op_f238_0_comp_nf, 0x00000022, 62008 }, /* FPP.L #<data>.W,(xxx).W */
+{ op_f239_0_comp_nf, 0x00000022, 62009 }, /* FPP.L #<data>.W,(xxx).L */
+{ op_f23a_0_comp_nf, 0x00000022, 62010 }, /* FPP.L #<data>.W,(d16,PC) */
+{ op_f23b_0_comp_nf, 0x00000022, 62011 }, /* FPP.L #<data>.W,(d8,PC,Xn) */
+{ op_f23c_0_comp_nf, 0x00000022, 62012 }, /* FPP.L #<data>.W,#<data>.L */
+{ op_f240_0_comp_nf, 0x00000026, 62016 }, /* FScc.L #<data>.W,Dn */
 { NULL, 0x00000021, 62024 }, /* FDBcc.L #<data>.W,Dn */
-{ NULL, 0x00000020, 62032 }, /* FScc.L #<data>.W,(An) */
-{ NULL, 0x00000020, 62040 }, /* FScc.L #<data>.W,(An)+ */
-{ NULL, 0x00000020, 62048 }, /* FScc.L #<data>.W,-(An) */
-{ NULL, 0x00000020, 62056 }, /* FScc.L #<data>.W,(d16,An) */
-{ NULL, 0x00000020, 62064 }, /* FScc.L #<data>.W,(d8,An,Xn) */
-{ NULL, 0x00000020, 62072 }, /* FScc.L #<data>.W,(xxx).W */
-{ NULL, 0x00000020, 62073 }, /* FScc.L #<data>.W,(xxx).L */
+{ op_f250_0_comp_nf, 0x00000026, 62032 }, /* FScc.L #<data>.W,(An) */
+{ op_f258_0_comp_nf, 0x00000026, 62040 }, /* FScc.L #<data>.W,(An)+ */
+{ op_f260_0_comp_nf, 0x00000026, 62048 }, /* FScc.L #<data>.W,-(An) */
+{ op_f268_0_comp_nf, 0x00000026, 62056 }, /* FScc.L #<data>.W,(d16,An) */
+{ op_f270_0_comp_nf, 0x00000026, 62064 }, /* FScc.L #<data>.W,(d8,An,Xn) */
+{ op_f278_0_comp_nf, 0x00000026, 62072 }, /* FScc.L #<data>.W,(xxx).W */
+{ op_f279_0_comp_nf, 0x00000026, 62073 }, /* FScc.L #<data>.W,(xxx).L */
 { NULL, 0x00000021, 62074 }, /* FTRAPcc.L #<data>.W */
 { NULL, 0x00000021, 62075 }, /* FTRAPcc.L #<data>.L */
 { NULL, 0x00000021, 62076 }, /* FTRAPcc.L  */
-{ NULL, 0x00000021, 62080 }, /* FBcc.L #<data>,#<data>.W */
-{ NULL, 0x00000021, 62144 }, /* FBcc.L #<data>,#<data>.L */
+{ op_f280_0_comp_nf, 0x00000025, 62080 }, /* FBcc.L #<data>,#<data>.W */
+{ op_f2c0_0_comp_nf, 0x00000025, 62144 }, /* FBcc.L #<data>,#<data>.L */
 { NULL, 0x00000020, 62224 }, /* FSAVE.L (An) */
 { NULL, 0x00000020, 62240 }, /* FSAVE.L -(An) */
 { NULL, 0x00000020, 62248 }, /* FSAVE.L (d16,An) */
@@ -89,6 +89,11 @@ extern bool UseJIT;
 const bool UseJIT = false;
 #endif
 
+// Instruction counting activation flag (calls cpu_do_check_ticks() when emulated_ticks runs out)
+#ifdef USE_CPU_EMUL_TICKS
+extern bool cpu_count_ticks;
+#endif
+
 // 680x0 emulation functions
 struct M68kRegisters;
 extern void Start680x0(void);									// Reset and start 680x0
@@ -38953,242 +38953,245 @@ void REGPARAM2 CPUFUNC(op_f620_0)(uae_u32 opcode) /* MOVE16.L (An)+,(An)+ */
 }
 
 #endif
-#endif
-
-
-#ifdef _MSC_VER
-#pragma warning(disable:4102)	/* unreferenced label */
-#endif
-
-#if !defined(PART_1) && !defined(PART_2) && !defined(PART_3) && !defined(PART_4) && !defined(PART_5) && !defined(PART_6) && !defined(PART_7) && !defined(PART_8)
-#define PART_1 1
-#define PART_2 1
-#define PART_3 1
-#define PART_4 1
-#define PART_5 1
-#define PART_6 1
-#define PART_7 1
-#define PART_8 1
-#endif
-
-#ifdef PART_1
-#endif
-
-#ifdef PART_2
-#endif
-
-#ifdef PART_3
-#endif
-
-#ifdef PART_4
-void REGPARAM2 CPUFUNC(op_4800_1)(uae_u32 opcode) /* NBCD.B Dn */
+void REGPARAM2 CPUFUNC(op_fused_5180_6601_0)(uae_u32 opcode) /* SUB.L #<data>,Dn; Bcc.B #<data> */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = - (src & 0xF0);
-	uae_u16 newv;
-	int cflg;
-	if (newv_lo > 9) { newv_lo -= 6; }
-	newv = newv_hi + newv_lo;
-	cflg = (newv & 0x1F0) > 0x90;
-	if (cflg) newv -= 0x60;
-	SET_CFLG (cflg);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((newv) & 0xff);
-}}}m68k_incpc(2);
-	cpuop_end();
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_4810_1)(uae_u32 opcode) /* NBCD.B (An) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s8 src = get_byte(srca);
-{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = - (src & 0xF0);
-	uae_u16 newv;
-	int cflg;
-	if (newv_lo > 9) { newv_lo -= 6; }
-	newv = newv_hi + newv_lo;
-	cflg = (newv & 0x1F0) > 0x90;
-	if (cflg) newv -= 0x60;
-	SET_CFLG (cflg);
-	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte(srca,newv);
-}}}}m68k_incpc(2);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1870: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4818_1)(uae_u32 opcode) /* NBCD.B (An)+ */
+void REGPARAM2 CPUFUNC(op_fused_d080_b180_0)(uae_u32 opcode) /* ADD.L Dn,Dn; EOR.L Dn,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s8 src = get_byte(srca);
-	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = - (src & 0xF0);
-	uae_u16 newv;
-	int cflg;
-	if (newv_lo > 9) { newv_lo -= 6; }
-	newv = newv_hi + newv_lo;
-	cflg = (newv & 0x1F0) > 0x90;
-	if (cflg) newv -= 0x60;
-	SET_CFLG (cflg);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte(srca,newv);
-}}}}m68k_incpc(2);
-	cpuop_end();
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_4820_1)(uae_u32 opcode) /* NBCD.B -(An) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte(srca);
-	m68k_areg (regs, srcreg) = srca;
-{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = - (src & 0xF0);
-	uae_u16 newv;
-	int cflg;
-	if (newv_lo > 9) { newv_lo -= 6; }
-	newv = newv_hi + newv_lo;
-	cflg = (newv & 0x1F0) > 0x90;
-	if (cflg) newv -= 0x60;
-	SET_CFLG (cflg);
-	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte(srca,newv);
-}}}}m68k_incpc(2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4828_1)(uae_u32 opcode) /* NBCD.B (d16,An) */
+void REGPARAM2 CPUFUNC(op_fused_b180_5080_0)(uae_u32 opcode) /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	uae_s8 src = get_byte(srca);
-{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = - (src & 0xF0);
-	uae_u16 newv;
-	int cflg;
-	if (newv_lo > 9) { newv_lo -= 6; }
-	newv = newv_hi + newv_lo;
-	cflg = (newv & 0x1F0) > 0x90;
-	if (cflg) newv -= 0x60;
-	SET_CFLG (cflg);
-	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte(srca,newv);
-}}}}m68k_incpc(4);
-	cpuop_end();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_4830_1)(uae_u32 opcode) /* NBCD.B (d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{m68k_incpc(2);
-{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
-{	uae_s8 src = get_byte(srca);
-{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = - (src & 0xF0);
-	uae_u16 newv;
-	int cflg;
-	if (newv_lo > 9) { newv_lo -= 6; }
-	newv = newv_hi + newv_lo;
-	cflg = (newv & 0x1F0) > 0x90;
-	if (cflg) newv -= 0x60;
-	SET_CFLG (cflg);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte(srca,newv);
-}}}}}	cpuop_end();
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_4838_1)(uae_u32 opcode) /* NBCD.B (xxx).W */
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_fused_5080_5180_0)(uae_u32 opcode) /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
-{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	uae_s8 src = get_byte(srca);
-{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = - (src & 0xF0);
-	uae_u16 newv;
-	int cflg;
-	if (newv_lo > 9) { newv_lo -= 6; }
-	newv = newv_hi + newv_lo;
-	cflg = (newv & 0x1F0) > 0x90;
-	if (cflg) newv -= 0x60;
-	SET_CFLG (cflg);
+{
+#include "noflags_push.h"
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte(srca,newv);
-}}}}m68k_incpc(4);
-	cpuop_end();
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_4839_1)(uae_u32 opcode) /* NBCD.B (xxx).L */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
-{{	uaecptr srca = get_ilong(2);
-{	uae_s8 src = get_byte(srca);
-{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = - (src & 0xF0);
-	uae_u16 newv;
-	int cflg;
-	if (newv_lo > 9) { newv_lo -= 6; }
-	newv = newv_hi + newv_lo;
-	cflg = (newv & 0x1F0) > 0x90;
-	if (cflg) newv -= 0x60;
-	SET_CFLG (cflg);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte(srca,newv);
-}}}}m68k_incpc(6);
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
+void REGPARAM2 CPUFUNC(op_fused_5080_d080_0)(uae_u32 opcode) /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
+{
+	cpuop_begin();
+{
+#include "noflags_push.h"
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-
-#ifdef PART_5
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
 #endif
-
-#ifdef PART_6
-void REGPARAM2 CPUFUNC(op_8100_1)(uae_u32 opcode) /* SBCD.B Dn,Dn */
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
+}
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -39199,27 +39202,58 @@ void REGPARAM2 CPUFUNC(op_8100_1)(uae_u32 opcode) /* SBCD.B Dn,Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-{	uae_u16 newv_lo = (dst & 0xF) - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = (dst & 0xF0) - (src & 0xF0);
-	uae_u16 newv, tmp_newv;
-	int bcd = 0;
-	newv = tmp_newv = newv_hi + newv_lo;
-	if (newv_lo & 0xF0) { newv -= 6; bcd = 6; };
-	if ((((dst & 0xFF) - (src & 0xFF) - (GET_XFLG ? 1 : 0)) & 0x100) > 0xFF) { newv -= 0x60; }
-	SET_CFLG ((((dst & 0xFF) - (src & 0xFF) - bcd - (GET_XFLG ? 1 : 0)) & 0x300) > 0xFF);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	SET_VFLG ((tmp_newv & 0x80) != 0 && (newv & 0x80) == 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}m68k_incpc(2);
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_8108_1)(uae_u32 opcode) /* SBCD.B -(An),-(An) */
+void REGPARAM2 CPUFUNC(op_fused_f200_f200_0)(uae_u32 opcode) /* FPP.L #<data>.W,Dn; FPP.L #<data>.W,Dn */
+{
+	cpuop_begin();
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 extra = get_iword(2);
+m68k_incpc(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
+#endif
+	fpuop_arithmetic(opcode, extra);
+}}}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 extra = get_iword(2);
+m68k_incpc(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
+#endif
+	fpuop_arithmetic(opcode, extra);
+}}}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_fused_d080_4e75_0)(uae_u32 opcode) /* ADD.L Dn,Dn; RTS.L  */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -39230,34 +39264,30 @@ void REGPARAM2 CPUFUNC(op_8108_1)(uae_u32 opcode) /* SBCD.B -(An),-(An) */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte(srca);
-	m68k_areg (regs, srcreg) = srca;
-{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte(dsta);
-	m68k_areg (regs, dstreg) = dsta;
-{	uae_u16 newv_lo = (dst & 0xF) - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = (dst & 0xF0) - (src & 0xF0);
-	uae_u16 newv, tmp_newv;
-	int bcd = 0;
-	newv = tmp_newv = newv_hi + newv_lo;
-	if (newv_lo & 0xF0) { newv -= 6; bcd = 6; };
-	if ((((dst & 0xFF) - (src & 0xFF) - (GET_XFLG ? 1 : 0)) & 0x100) > 0xFF) { newv -= 0x60; }
-	SET_CFLG ((((dst & 0xFF) - (src & 0xFF) - bcd - (GET_XFLG ? 1 : 0)) & 0x300) > 0xFF);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	SET_VFLG ((tmp_newv & 0x80) != 0 && (newv & 0x80) == 0);
-	put_byte(dsta,newv);
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+{	m68k_do_rts();
+}}
 	cpuop_end();
 }
-#endif
-
-#ifdef PART_7
-void REGPARAM2 CPUFUNC(op_c100_1)(uae_u32 opcode) /* ABCD.B Dn,Dn */
+void REGPARAM2 CPUFUNC(op_fused_20d8_51c8_0)(uae_u32 opcode) /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -39268,28 +39298,57 @@ void REGPARAM2 CPUFUNC(op_c100_1)(uae_u32 opcode) /* ABCD.B Dn,Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-{	uae_u16 newv_lo = (src & 0xF) + (dst & 0xF) + (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = (src & 0xF0) + (dst & 0xF0);
-	uae_u16 newv, tmp_newv;
-	int cflg;
-	newv = tmp_newv = newv_hi + newv_lo;
-	if (newv_lo > 9) { newv += 6; }
-	cflg = (newv & 0x3F0) > 0x90;
-	if (cflg) newv += 0x60;
-	SET_CFLG (cflg);
-	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	SET_VFLG ((tmp_newv & 0x80) == 0 && (newv & 0x80) != 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
 }}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1884: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c108_1)(uae_u32 opcode) /* ABCD.B -(An),-(An) */
+void REGPARAM2 CPUFUNC(op_fused_48e0_d080_0)(uae_u32 opcode) /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
 {
 	cpuop_begin();
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) - 0;
+{	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
+	opcode = GET_OPCODE;
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -39300,871 +39359,1002 @@ void REGPARAM2 CPUFUNC(op_c108_1)(uae_u32 opcode) /* ABCD.B -(An),-(An) */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte(srca);
-	m68k_areg (regs, srcreg) = srca;
-{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
-{	uae_s8 dst = get_byte(dsta);
-	m68k_areg (regs, dstreg) = dsta;
-{	uae_u16 newv_lo = (src & 0xF) + (dst & 0xF) + (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = (src & 0xF0) + (dst & 0xF0);
-	uae_u16 newv, tmp_newv;
-	int cflg;
-	newv = tmp_newv = newv_hi + newv_lo;
-	if (newv_lo > 9) { newv += 6; }
-	cflg = (newv & 0x3F0) > 0x90;
-	if (cflg) newv += 0x60;
-	SET_CFLG (cflg);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	SET_VFLG ((tmp_newv & 0x80) == 0 && (newv & 0x80) != 0);
-	put_byte(dsta,newv);
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
 }}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-#endif
-
-#ifdef PART_8
-#endif
-
-
-#ifdef _MSC_VER
-#pragma warning(disable:4102)	/* unreferenced label */
-#endif
-
-#if !defined(PART_1) && !defined(PART_2) && !defined(PART_3) && !defined(PART_4) && !defined(PART_5) && !defined(PART_6) && !defined(PART_7) && !defined(PART_8)
-#define PART_1 1
-#define PART_2 1
-#define PART_3 1
-#define PART_4 1
-#define PART_5 1
-#define PART_6 1
-#define PART_7 1
-#define PART_8 1
-#endif
-
-#ifdef PART_1
-#endif
-
-#ifdef PART_2
-#endif
-
-#ifdef PART_3
-#endif
-
-#ifdef PART_4
-#endif
-
-#ifdef PART_5
-#endif
-
-#ifdef PART_6
-#endif
-
-#ifdef PART_7
-#endif
-
-#ifdef PART_8
-#endif
-
-
-#ifdef _MSC_VER
-#pragma warning(disable:4102)	/* unreferenced label */
-#endif
-
-#if !defined(PART_1) && !defined(PART_2) && !defined(PART_3) && !defined(PART_4) && !defined(PART_5) && !defined(PART_6) && !defined(PART_7) && !defined(PART_8)
-#define PART_1 1
-#define PART_2 1
-#define PART_3 1
-#define PART_4 1
-#define PART_5 1
-#define PART_6 1
-#define PART_7 1
-#define PART_8 1
-#endif
-
-#ifdef PART_1
-void REGPARAM2 CPUFUNC(op_30_3)(uae_u32 opcode) /* OR.B #<data>.B,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_d080_4cd8_0)(uae_u32 opcode) /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s8 src = get_ibyte(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_70_3)(uae_u32 opcode) /* OR.W #<data>.W,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s16 dst = get_word(dsta);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(6);
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0_3)(uae_u32 opcode) /* OR.L #<data>.L,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_4cd8_5180_0)(uae_u32 opcode) /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s32 src = get_ilong(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-{	uae_s32 dst = get_long(dsta);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(8);
-	cpuop_end();
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
 }
-void REGPARAM2 CPUFUNC(op_130_3)(uae_u32 opcode) /* BTST.B Dn,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-}}}}m68k_incpc(4);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_13b_3)(uae_u32 opcode) /* BTST.B Dn,(d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_f200_5180_0)(uae_u32 opcode) /* FPP.L #<data>.W,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-	uae_u32 dstreg = 3;
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_170_3)(uae_u32 opcode) /* BCHG.B Dn,(d8,An,Xn) */
+{{	uae_s16 extra = get_iword(2);
+m68k_incpc(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
+#endif
+	fpuop_arithmetic(opcode, extra);
+}}}
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	dst ^= (1 << src);
-	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(4);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_17b_3)(uae_u32 opcode) /* BCHG.B Dn,(d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_33c0_f438_0)(uae_u32 opcode) /* MOVE.W Dn,(xxx).L; CPUSHA.L #<data> */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = (opcode & 7);
 #endif
-	uae_u32 dstreg = 3;
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	dst ^= (1 << src);
-	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_ilong(2);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
 }
-void REGPARAM2 CPUFUNC(op_1b0_3)(uae_u32 opcode) /* BCLR.B Dn,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = ((opcode >> 14) & 3);
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = ((opcode >> 6) & 3);
 #endif
+{if (!regs.s) { Exception(8,0); goto endlabel1894; }
+{	if (srcreg&0x2)
+		flush_icache(43);
+}}m68k_incpc(2);
+endlabel1894: ;
+}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_fused_640_5180_0)(uae_u32 opcode) /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
+{
+	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-	dst &= ~(1 << src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_1bb_3)(uae_u32 opcode) /* BCLR.B Dn,(d8,PC,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-	uae_u32 dstreg = 3;
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-	dst &= ~(1 << src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_1f0_3)(uae_u32 opcode) /* BSET.B Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_d098_51c8_0)(uae_u32 opcode) /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = (opcode & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-	dst |= (1 << src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_1fb_3)(uae_u32 opcode) /* BSET.B Dn,(d8,PC,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = (opcode & 7);
 #endif
-	uae_u32 dstreg = 3;
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-	dst |= (1 << src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(4);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1898: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_230_3)(uae_u32 opcode) /* AND.B #<data>.B,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_41f9_303c_0)(uae_u32 opcode) /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s8 src = get_ibyte(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-void REGPARAM2 CPUFUNC(op_270_3)(uae_u32 opcode) /* AND.W #<data>.W,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s16 dst = get_word(dsta);
-	src &= dst;
-	CLEAR_CZNV;
+{	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(6);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_2b0_3)(uae_u32 opcode) /* AND.L #<data>.L,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_303c_20d8_0)(uae_u32 opcode) /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s32 src = get_ilong(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-{	uae_s32 dst = get_long(dsta);
-	src &= dst;
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+#include "noflags_pop.h"
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
 	put_long(dsta,src);
-}}}}m68k_incpc(8);
+}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_41f9_41f9_0)(uae_u32 opcode) /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s8 src = get_ibyte(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
-	cpuop_end();
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-void REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
-	cpuop_end();
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-void REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) */
+	cpuop_end();
+}
+#endif
+
+
+#ifdef _MSC_VER
+#pragma warning(disable:4102)	/* unreferenced label */
+#endif
+
+#if !defined(PART_1) && !defined(PART_2) && !defined(PART_3) && !defined(PART_4) && !defined(PART_5) && !defined(PART_6) && !defined(PART_7) && !defined(PART_8)
+#define PART_1 1
+#define PART_2 1
+#define PART_3 1
+#define PART_4 1
+#define PART_5 1
+#define PART_6 1
+#define PART_7 1
+#define PART_8 1
+#endif
+
+#ifdef PART_1
+#endif
+
+#ifdef PART_2
+#endif
+
+#ifdef PART_3
+#endif
+
+#ifdef PART_4
+void REGPARAM2 CPUFUNC(op_4800_1)(uae_u32 opcode) /* NBCD.B Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s32 src = get_ilong(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-{	uae_s32 dst = get_long(dsta);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo -= 6; }
+	newv = newv_hi + newv_lo;
+	cflg = (newv & 0x1F0) > 0x90;
+	if (cflg) newv -= 0x60;
+	SET_CFLG (cflg);
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xff) | ((newv) & 0xff);
+}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_4810_1)(uae_u32 opcode) /* NBCD.B (An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s8 src = get_ibyte(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo -= 6; }
+	newv = newv_hi + newv_lo;
+	cflg = (newv & 0x1F0) > 0x90;
+	if (cflg) newv -= 0x60;
+	SET_CFLG (cflg);
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(6);
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_4818_1)(uae_u32 opcode) /* NBCD.B (An)+ */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo -= 6; }
+	newv = newv_hi + newv_lo;
+	cflg = (newv & 0x1F0) > 0x90;
+	if (cflg) newv -= 0x60;
+	SET_CFLG (cflg);
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_word(dsta,newv);
-}}}}}}}m68k_incpc(6);
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_4820_1)(uae_u32 opcode) /* NBCD.B -(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s32 src = get_ilong(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-{	uae_s32 dst = get_long(dsta);
-{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo -= 6; }
+	newv = newv_hi + newv_lo;
+	cflg = (newv & 0x1F0) > 0x90;
+	if (cflg) newv -= 0x60;
+	SET_CFLG (cflg);
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_long(dsta,newv);
-}}}}}}}m68k_incpc(8);
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_830_3)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_4828_1)(uae_u32 opcode) /* NBCD.B (d16,An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-}}}}m68k_incpc(6);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_83b_3)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,PC,Xn) */
-{
-	cpuop_begin();
-	uae_u32 dstreg = 3;
-{{	uae_s16 src = get_iword(2);
-{	uaecptr tmppc = m68k_getpc() + 4;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-}}}}m68k_incpc(6);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo -= 6; }
+	newv = newv_hi + newv_lo;
+	cflg = (newv & 0x1F0) > 0x90;
+	if (cflg) newv -= 0x60;
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_870_3)(uae_u32 opcode) /* BCHG.B #<data>.W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_4830_1)(uae_u32 opcode) /* NBCD.B (d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	dst ^= (1 << src);
-	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(6);
-	cpuop_end();
+{{m68k_incpc(2);
+{	uaecptr srca = get_disp_ea_020(m68k_areg(regs, srcreg), next_iword());
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo -= 6; }
+	newv = newv_hi + newv_lo;
+	cflg = (newv & 0x1F0) > 0x90;
+	if (cflg) newv -= 0x60;
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_87b_3)(uae_u32 opcode) /* BCHG.B #<data>.W,(d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_4838_1)(uae_u32 opcode) /* NBCD.B (xxx).W */
 {
 	cpuop_begin();
-	uae_u32 dstreg = 3;
-{{	uae_s16 src = get_iword(2);
-{	uaecptr tmppc = m68k_getpc() + 4;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	dst ^= (1 << src);
-	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(6);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_8b0_3)(uae_u32 opcode) /* BCLR.B #<data>.W,(d8,An,Xn) */
-{
-	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
-#else
-	uae_u32 dstreg = opcode & 7;
-#endif
-{{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-	dst &= ~(1 << src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(6);
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo -= 6; }
+	newv = newv_hi + newv_lo;
+	cflg = (newv & 0x1F0) > 0x90;
+	if (cflg) newv -= 0x60;
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_8bb_3)(uae_u32 opcode) /* BCLR.B #<data>.W,(d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_4839_1)(uae_u32 opcode) /* NBCD.B (xxx).L */
 {
 	cpuop_begin();
-	uae_u32 dstreg = 3;
-{{	uae_s16 src = get_iword(2);
-{	uaecptr tmppc = m68k_getpc() + 4;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-	dst &= ~(1 << src);
-	put_byte(dsta,dst);
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo -= 6; }
+	newv = newv_hi + newv_lo;
+	cflg = (newv & 0x1F0) > 0x90;
+	if (cflg) newv -= 0x60;
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_8f0_3)(uae_u32 opcode) /* BSET.B #<data>.W,(d8,An,Xn) */
+#endif
+
+#ifdef PART_5
+#endif
+
+#ifdef PART_6
+void REGPARAM2 CPUFUNC(op_8100_1)(uae_u32 opcode) /* SBCD.B Dn,Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-	dst |= (1 << src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(6);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u16 newv_lo = (dst & 0xF) - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (dst & 0xF0) - (src & 0xF0);
+	uae_u16 newv, tmp_newv;
+	int bcd = 0;
+	newv = tmp_newv = newv_hi + newv_lo;
+	if (newv_lo & 0xF0) { newv -= 6; bcd = 6; };
+	if ((((dst & 0xFF) - (src & 0xFF) - (GET_XFLG ? 1 : 0)) & 0x100) > 0xFF) { newv -= 0x60; }
+	SET_CFLG ((((dst & 0xFF) - (src & 0xFF) - bcd - (GET_XFLG ? 1 : 0)) & 0x300) > 0xFF);
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	SET_VFLG ((tmp_newv & 0x80) != 0 && (newv & 0x80) == 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_8fb_3)(uae_u32 opcode) /* BSET.B #<data>.W,(d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_8108_1)(uae_u32 opcode) /* SBCD.B -(An),-(An) */
 {
 	cpuop_begin();
-	uae_u32 dstreg = 3;
-{{	uae_s16 src = get_iword(2);
-{	uaecptr tmppc = m68k_getpc() + 4;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
 {	uae_s8 dst = get_byte(dsta);
-	src &= 7;
-	SET_ZFLG (1 ^ ((dst >> src) & 1));
-	dst |= (1 << src);
-	put_byte(dsta,dst);
-}}}}m68k_incpc(6);
+	m68k_areg (regs, dstreg) = dsta;
+{	uae_u16 newv_lo = (dst & 0xF) - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (dst & 0xF0) - (src & 0xF0);
+	uae_u16 newv, tmp_newv;
+	int bcd = 0;
+	newv = tmp_newv = newv_hi + newv_lo;
+	if (newv_lo & 0xF0) { newv -= 6; bcd = 6; };
+	if ((((dst & 0xFF) - (src & 0xFF) - (GET_XFLG ? 1 : 0)) & 0x100) > 0xFF) { newv -= 0x60; }
+	SET_CFLG ((((dst & 0xFF) - (src & 0xFF) - bcd - (GET_XFLG ? 1 : 0)) & 0x300) > 0xFF);
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	SET_VFLG ((tmp_newv & 0x80) != 0 && (newv & 0x80) == 0);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_a30_3)(uae_u32 opcode) /* EOR.B #<data>.B,(d8,An,Xn) */
+#endif
+
+#ifdef PART_7
+void REGPARAM2 CPUFUNC(op_c100_1)(uae_u32 opcode) /* ABCD.B Dn,Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s8 src = get_ibyte(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{	uae_u16 newv_lo = (src & 0xF) + (dst & 0xF) + (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (src & 0xF0) + (dst & 0xF0);
+	uae_u16 newv, tmp_newv;
+	int cflg;
+	newv = tmp_newv = newv_hi + newv_lo;
+	if (newv_lo > 9) { newv += 6; }
+	cflg = (newv & 0x3F0) > 0x90;
+	if (cflg) newv += 0x60;
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	SET_VFLG ((tmp_newv & 0x80) == 0 && (newv & 0x80) != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_a70_3)(uae_u32 opcode) /* EOR.W #<data>.W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_c108_1)(uae_u32 opcode) /* ABCD.B -(An),-(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s16 dst = get_word(dsta);
-	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(6);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+{	uae_s8 dst = get_byte(dsta);
+	m68k_areg (regs, dstreg) = dsta;
+{	uae_u16 newv_lo = (src & 0xF) + (dst & 0xF) + (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = (src & 0xF0) + (dst & 0xF0);
+	uae_u16 newv, tmp_newv;
+	int cflg;
+	newv = tmp_newv = newv_hi + newv_lo;
+	if (newv_lo > 9) { newv += 6; }
+	cflg = (newv & 0x3F0) > 0x90;
+	if (cflg) newv += 0x60;
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	SET_VFLG ((tmp_newv & 0x80) == 0 && (newv & 0x80) != 0);
+	put_byte(dsta,newv);
+}}}}}}m68k_incpc(2);
 	cpuop_end();
 }
 #endif
 
-#ifdef PART_2
-void REGPARAM2 CPUFUNC(op_ab0_3)(uae_u32 opcode) /* EOR.L #<data>.L,(d8,An,Xn) */
+#ifdef PART_8
+void REGPARAM2 CPUFUNC(op_fused_5180_6601_1)(uae_u32 opcode) /* SUB.L #<data>,Dn; Bcc.B #<data> */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uae_s32 src = get_ilong(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-{	uae_s32 dst = get_long(dsta);
-	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(8);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s8 src = get_ibyte(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
-	cpuop_end();
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
-	uae_u32 dstreg = 3;
-{{	uae_s8 src = get_ibyte(2);
-{	uaecptr tmppc = m68k_getpc() + 4;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
-{	uae_s8 dst = get_byte(dsta);
-{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1918: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_d080_b180_1)(uae_u32 opcode) /* ADD.L Dn,Dn; EOR.L Dn,Dn */
 {
 	cpuop_begin();
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s16 src = get_iword(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_b180_5080_1)(uae_u32 opcode) /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
 {
 	cpuop_begin();
-	uae_u32 dstreg = 3;
-{{	uae_s16 src = get_iword(2);
-{	uaecptr tmppc = m68k_getpc() + 4;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(6);
-	cpuop_end();
+{
+#include "noflags_push.h"
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s32 src = get_ilong(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-{	uae_s32 dst = get_long(dsta);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_5080_5180_1)(uae_u32 opcode) /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
-	uae_u32 dstreg = 3;
-{{	uae_s32 src = get_ilong(2);
-{	uaecptr tmppc = m68k_getpc() + 6;
-	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(6));
-{	uae_s32 dst = get_long(dsta);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{
+#include "noflags_push.h"
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(8);
-	cpuop_end();
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
-}}}}m68k_incpc(4);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_103b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_5080_d080_1)(uae_u32 opcode) /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
-}}}}m68k_incpc(4);
-	cpuop_end();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40175,82 +40365,58 @@ void REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An) */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_10bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An) */
-{
-	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_10f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An)+ */
+void REGPARAM2 CPUFUNC(op_fused_f200_f200_1)(uae_u32 opcode) /* FPP.L #<data>.W,Dn; FPP.L #<data>.W,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
+{{	uae_s16 extra = get_iword(2);
+m68k_incpc(4);
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_10fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An)+ */
+	fpuop_arithmetic(opcode, extra);
+}}}
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_s16 extra = get_iword(2);
+m68k_incpc(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
+#endif
+	fpuop_arithmetic(opcode, extra);
+}}}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),-(An) */
+void REGPARAM2 CPUFUNC(op_fused_d080_4e75_1)(uae_u32 opcode) /* ADD.L Dn,Dn; RTS.L  */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40261,40 +40427,30 @@ void REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),-(An) */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
-	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_113b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),-(An) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
-	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
+{	m68k_do_rts();
+}}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d16,An) */
+void REGPARAM2 CPUFUNC(op_fused_20d8_51c8_1)(uae_u32 opcode) /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40305,60 +40461,57 @@ void REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d16,An)
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_117b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d16,An) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1932: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_1180_3)(uae_u32 opcode) /* MOVE.B Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_48e0_d080_1)(uae_u32 opcode) /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) - 0;
+{	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	m68k_areg(regs, dstreg) = srca;
 }}}m68k_incpc(4);
-	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE.B (An),(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40369,19 +40522,26 @@ void REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE.B (An),(d8,An,Xn) */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE.B (An)+,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_d080_4cd8_1)(uae_u32 opcode) /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40392,327 +40552,417 @@ void REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE.B (An)+,(d8,An,Xn) */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s8 src = get_byte(srca);
-	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_11a0_3)(uae_u32 opcode) /* MOVE.B -(An),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_4cd8_5180_1)(uae_u32 opcode) /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
+	opcode = GET_OPCODE;
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
-{	uae_s8 src = get_byte(srca);
-	m68k_areg (regs, srcreg) = srca;
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_11a8_3)(uae_u32 opcode) /* MOVE.B (d16,An),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_f200_5180_1)(uae_u32 opcode) /* FPP.L #<data>.W,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
+{{	uae_s16 extra = get_iword(2);
+m68k_incpc(4);
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	opcode = ((opcode << 8) & 0xFF00) | ((opcode >> 8) & 0xFF);
+#endif
+	fpuop_arithmetic(opcode, extra);
+}}}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_11b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_640_5180_1)(uae_u32 opcode) /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+#include "noflags_pop.h"
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_11b8_3)(uae_u32 opcode) /* MOVE.B (xxx).W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_d098_51c8_1)(uae_u32 opcode) /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_11b9_3)(uae_u32 opcode) /* MOVE.B (xxx).L,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_ilong(2);
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(8);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1944: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_11ba_3)(uae_u32 opcode) /* MOVE.B (d16,PC),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_41f9_303c_1)(uae_u32 opcode) /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_getpc () + 2;
-	srca += (uae_s32)(uae_s16)get_iword(2);
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-void REGPARAM2 CPUFUNC(op_11bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_11bc_3)(uae_u32 opcode) /* MOVE.B #<data>.B,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_303c_20d8_1)(uae_u32 opcode) /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s8 src = get_ibyte(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}m68k_incpc(6);
-	cpuop_end();
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_11f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).W */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_11fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).W */
-{
-	cpuop_begin();
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_13f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).L */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = get_ilong(4);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(8);
-	cpuop_end();
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_13fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).L */
-{
-	cpuop_begin();
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(8);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_2030_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_41f9_41f9_1)(uae_u32 opcode) /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (src);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-void REGPARAM2 CPUFUNC(op_203b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),Dn */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (src);
-}}}}m68k_incpc(4);
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
+}
 	cpuop_end();
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_2070_3)(uae_u32 opcode) /* MOVEA.L (d8,An,Xn),An */
+#endif
+
+
+#ifdef _MSC_VER
+#pragma warning(disable:4102)	/* unreferenced label */
+#endif
+
+#if !defined(PART_1) && !defined(PART_2) && !defined(PART_3) && !defined(PART_4) && !defined(PART_5) && !defined(PART_6) && !defined(PART_7) && !defined(PART_8)
+#define PART_1 1
+#define PART_2 1
+#define PART_3 1
+#define PART_4 1
+#define PART_5 1
+#define PART_6 1
+#define PART_7 1
+#define PART_8 1
+#endif
+
+#ifdef PART_1
+#endif
+
+#ifdef PART_2
+#endif
+
+#ifdef PART_3
+#endif
+
+#ifdef PART_4
+#endif
+
+#ifdef PART_5
+#endif
+
+#ifdef PART_6
+#endif
+
+#ifdef PART_7
+#endif
+
+#ifdef PART_8
+void REGPARAM2 CPUFUNC(op_fused_5180_6601_2)(uae_u32 opcode) /* SUB.L #<data>,Dn; Bcc.B #<data> */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_u32 val = src;
-	m68k_areg(regs, dstreg) = (val);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_207b_3)(uae_u32 opcode) /* MOVEA.L (d8,PC,Xn),An */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_u32 val = src;
-	m68k_areg(regs, dstreg) = (val);
-}}}}m68k_incpc(4);
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel1952: ;
+}
 	cpuop_end();
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An) */
+void REGPARAM2 CPUFUNC(op_fused_d080_b180_2)(uae_u32 opcode) /* ADD.L Dn,Dn; EOR.L Dn,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40723,171 +40973,186 @@ void REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An) */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_20bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_20f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An)+ */
+void REGPARAM2 CPUFUNC(op_fused_b180_5080_2)(uae_u32 opcode) /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	m68k_areg(regs, dstreg) += 4;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_20fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An)+ */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	m68k_areg(regs, dstreg) += 4;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_2130_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),-(An) */
-{
-	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
-	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_213b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),-(An) */
+void REGPARAM2 CPUFUNC(op_fused_5080_5180_2)(uae_u32 opcode) /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
-	m68k_areg (regs, dstreg) = dsta;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
-}
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
 #endif
-
-#ifdef PART_3
-void REGPARAM2 CPUFUNC(op_2170_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d16,An) */
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
+}
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(6);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_217b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d16,An) */
+void REGPARAM2 CPUFUNC(op_fused_5080_d080_2)(uae_u32 opcode) /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE.L Dn,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40899,17 +41164,25 @@ void REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE.L Dn,(d8,An,Xn) */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}m68k_incpc(4);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE.L An,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_d080_4e75_2)(uae_u32 opcode) /* ADD.L Dn,Dn; RTS.L  */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40920,18 +41193,30 @@ void REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE.L An,(d8,An,Xn) */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s32 src = m68k_areg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}m68k_incpc(4);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+{	m68k_do_rts();
+}}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE.L (An),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_20d8_51c8_2)(uae_u32 opcode) /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40944,41 +41229,55 @@ void REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE.L (An),(d8,An,Xn) */
 #endif
 {{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
 	put_long(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
+}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_2198_3)(uae_u32 opcode) /* MOVE.L (An)+,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1964: ;
+}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_fused_48e0_d080_2)(uae_u32 opcode) /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
+{
+	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s32 src = get_long(srca);
-	m68k_areg(regs, srcreg) += 4;
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) - 0;
+{	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
 }
-void REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE.L -(An),(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -40989,20 +41288,26 @@ void REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE.L -(An),(d8,An,Xn) */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
-{	uae_s32 src = get_long(srca);
-	m68k_areg (regs, srcreg) = srca;
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE.L (d16,An),(d8,An,Xn) */
-{
-	cpuop_begin();
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_fused_d080_4cd8_2)(uae_u32 opcode) /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
+{
+	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -41013,19 +41318,139 @@ void REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE.L (d16,An),(d8,An,Xn)
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(6);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_4cd8_5180_2)(uae_u32 opcode) /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
+{
+	cpuop_begin();
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_fused_640_5180_2)(uae_u32 opcode) /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
+{
+	cpuop_begin();
+{
+#include "noflags_push.h"
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+#include "noflags_pop.h"
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_fused_d098_51c8_2)(uae_u32 opcode) /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -41036,164 +41461,210 @@ void REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d8,An,Xn
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(6);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel1974: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_21b8_3)(uae_u32 opcode) /* MOVE.L (xxx).W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_41f9_303c_2)(uae_u32 opcode) /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-void REGPARAM2 CPUFUNC(op_21b9_3)(uae_u32 opcode) /* MOVE.L (xxx).L,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_ilong(2);
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(8);
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_21ba_3)(uae_u32 opcode) /* MOVE.L (d16,PC),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_303c_20d8_2)(uae_u32 opcode) /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_getpc () + 2;
-	srca += (uae_s32)(uae_s16)get_iword(2);
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_21bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
 	put_long(dsta,src);
-}}}}m68k_incpc(6);
+}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_21bc_3)(uae_u32 opcode) /* MOVE.L #<data>.L,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_41f9_41f9_2)(uae_u32 opcode) /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s32 src = get_ilong(2);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}m68k_incpc(8);
-	cpuop_end();
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-void REGPARAM2 CPUFUNC(op_21f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).W */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(6);
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_21fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).W */
+#endif
+
+
+#ifdef _MSC_VER
+#pragma warning(disable:4102)	/* unreferenced label */
+#endif
+
+#if !defined(PART_1) && !defined(PART_2) && !defined(PART_3) && !defined(PART_4) && !defined(PART_5) && !defined(PART_6) && !defined(PART_7) && !defined(PART_8)
+#define PART_1 1
+#define PART_2 1
+#define PART_3 1
+#define PART_4 1
+#define PART_5 1
+#define PART_6 1
+#define PART_7 1
+#define PART_8 1
+#endif
+
+#ifdef PART_1
+void REGPARAM2 CPUFUNC(op_30_3)(uae_u32 opcode) /* OR.B #<data>.B,(d8,An,Xn) */
 {
 	cpuop_begin();
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_23f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).L */
+void REGPARAM2 CPUFUNC(op_70_3)(uae_u32 opcode) /* OR.W #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = get_ilong(4);
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(8);
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).L */
+void REGPARAM2 CPUFUNC(op_b0_3)(uae_u32 opcode) /* OR.L #<data>.L,(d8,An,Xn) */
 {
 	cpuop_begin();
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uaecptr dsta = get_ilong(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
@@ -41201,665 +41672,687 @@ void REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).L *
 }}}}m68k_incpc(8);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_3030_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_130_3)(uae_u32 opcode) /* BTST.B Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_303b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_13b_3)(uae_u32 opcode) /* BTST.B Dn,(d8,PC,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_3070_3)(uae_u32 opcode) /* MOVEA.W (d8,An,Xn),An */
+void REGPARAM2 CPUFUNC(op_170_3)(uae_u32 opcode) /* BCHG.B Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_u32 val = (uae_s32)(uae_s16)src;
-	m68k_areg(regs, dstreg) = (val);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
+	put_byte(dsta,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_307b_3)(uae_u32 opcode) /* MOVEA.W (d8,PC,Xn),An */
+void REGPARAM2 CPUFUNC(op_17b_3)(uae_u32 opcode) /* BCHG.B Dn,(d8,PC,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_u32 val = (uae_s32)(uae_s16)src;
-	m68k_areg(regs, dstreg) = (val);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
+	put_byte(dsta,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_30b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An) */
+void REGPARAM2 CPUFUNC(op_1b0_3)(uae_u32 opcode) /* BCLR.B Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_30bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An) */
+void REGPARAM2 CPUFUNC(op_1bb_3)(uae_u32 opcode) /* BCLR.B Dn,(d8,PC,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_30f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An)+ */
+void REGPARAM2 CPUFUNC(op_1f0_3)(uae_u32 opcode) /* BSET.B Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_30fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An)+ */
+void REGPARAM2 CPUFUNC(op_1fb_3)(uae_u32 opcode) /* BSET.B Dn,(d8,PC,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg);
-	m68k_areg(regs, dstreg) += 2;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_3130_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),-(An) */
+void REGPARAM2 CPUFUNC(op_230_3)(uae_u32 opcode) /* AND.B #<data>.B,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
-	m68k_areg (regs, dstreg) = dsta;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(4);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_313b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),-(An) */
+void REGPARAM2 CPUFUNC(op_270_3)(uae_u32 opcode) /* AND.W #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
-	m68k_areg (regs, dstreg) = dsta;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
 	put_word(dsta,src);
-}}}}m68k_incpc(4);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_3170_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d16,An) */
+void REGPARAM2 CPUFUNC(op_2b0_3)(uae_u32 opcode) /* AND.L #<data>.L,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(6);
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_317b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d16,An) */
+void REGPARAM2 CPUFUNC(op_430_3)(uae_u32 opcode) /* SUB.B #<data>.B,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(6);
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_3180_3)(uae_u32 opcode) /* MOVE.W Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_470_3)(uae_u32 opcode) /* SUB.W #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}m68k_incpc(4);
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_3188_3)(uae_u32 opcode) /* MOVE.W An,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_4b0_3)(uae_u32 opcode) /* SUB.L #<data>.L,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s16 src = m68k_areg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}m68k_incpc(4);
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_3190_3)(uae_u32 opcode) /* MOVE.W (An),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_630_3)(uae_u32 opcode) /* ADD.B #<data>.B,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_670_3)(uae_u32 opcode) /* ADD.W #<data>.W,(d8,An,Xn) */
+{
+	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_3198_3)(uae_u32 opcode) /* MOVE.W (An)+,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_6b0_3)(uae_u32 opcode) /* ADD.L #<data>.L,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-{	uae_s16 src = get_word(srca);
-	m68k_areg(regs, srcreg) += 2;
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31a0_3)(uae_u32 opcode) /* MOVE.W -(An),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_830_3)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
-{	uae_s16 src = get_word(srca);
-	m68k_areg (regs, srcreg) = srca;
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31a8_3)(uae_u32 opcode) /* MOVE.W (d16,An),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_83b_3)(uae_u32 opcode) /* BTST.B #<data>.W,(d8,PC,Xn) */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_870_3)(uae_u32 opcode) /* BCHG.B #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
+{{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
+	put_byte(dsta,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31b8_3)(uae_u32 opcode) /* MOVE.W (xxx).W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_87b_3)(uae_u32 opcode) /* BCHG.B #<data>.W,(d8,PC,Xn) */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	dst ^= (1 << src);
+	SET_ZFLG (((uae_u32)dst & (1 << src)) >> src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_8b0_3)(uae_u32 opcode) /* BCLR.B #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-{	uae_s16 src = get_word(srca);
+{{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31b9_3)(uae_u32 opcode) /* MOVE.W (xxx).L,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_8bb_3)(uae_u32 opcode) /* BCLR.B #<data>.W,(d8,PC,Xn) */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr srca = get_ilong(2);
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(8);
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst &= ~(1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31ba_3)(uae_u32 opcode) /* MOVE.W (d16,PC),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_8f0_3)(uae_u32 opcode) /* BSET.B #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = m68k_getpc () + 2;
-	srca += (uae_s32)(uae_s16)get_iword(2);
-{	uae_s16 src = get_word(srca);
+{{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_8fb_3)(uae_u32 opcode) /* BSET.B #<data>.W,(d8,PC,Xn) */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src &= 7;
+	SET_ZFLG (1 ^ ((dst >> src) & 1));
+	dst |= (1 << src);
+	put_byte(dsta,dst);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_a30_3)(uae_u32 opcode) /* EOR.B #<data>.B,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
+{{	uae_s8 src = get_ibyte(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
 }}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31bc_3)(uae_u32 opcode) /* MOVE.W #<data>.W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_a70_3)(uae_u32 opcode) /* EOR.W #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
 {{	uae_s16 src = get_iword(2);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s16)(src)) == 0);
 	SET_NFLG (((uae_s16)(src)) < 0);
 	put_word(dsta,src);
-}}}m68k_incpc(6);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).W */
+#endif
+
+#ifdef PART_2
+void REGPARAM2 CPUFUNC(op_ab0_3)(uae_u32 opcode) /* EOR.L #<data>.L,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(6);
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_31fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).W */
-{
-	cpuop_begin();
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(6);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_33f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).L */
+void REGPARAM2 CPUFUNC(op_c30_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(8);
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_33fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).L */
+void REGPARAM2 CPUFUNC(op_c3b_3)(uae_u32 opcode) /* CMP.B #<data>.B,(d8,PC,Xn) */
 {
 	cpuop_begin();
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uaecptr dsta = get_ilong(4);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(8);
+	uae_u32 dstreg = 3;
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4030_3)(uae_u32 opcode) /* NEGX.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_c70_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
-	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
-	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte(srca,newv);
-}}}}}m68k_incpc(4);
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4070_3)(uae_u32 opcode) /* NEGX.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_c7b_3)(uae_u32 opcode) /* CMP.W #<data>.W,(d8,PC,Xn) */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+	uae_u32 dstreg = 3;
+{{	uae_s16 src = get_iword(2);
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(4));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
 {	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
 	int flgn = ((uae_s16)(newv)) < 0;
-	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
-	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
-	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
-	SET_NFLG (((uae_s16)(newv)) < 0);
-	put_word(srca,newv);
-}}}}}m68k_incpc(4);
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_40b0_3)(uae_u32 opcode) /* NEGX.L (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_cb0_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
-	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
-	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
-	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
-	SET_NFLG (((uae_s32)(newv)) < 0);
-	put_long(srca,newv);
-}}}}}m68k_incpc(4);
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_40f0_3)(uae_u32 opcode) /* MVSR2.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_cbb_3)(uae_u32 opcode) /* CMP.L #<data>.L,(d8,PC,Xn) */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-{if (!regs.s) { Exception(8,0); goto endlabel2002; }
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	MakeSR();
-	put_word(srca,regs.sr);
-}}}m68k_incpc(4);
-endlabel2002: ;
+	uae_u32 dstreg = 3;
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr tmppc = m68k_getpc() + 6;
+	uaecptr dsta = get_disp_ea_000(tmppc, get_iword(6));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(8);
 	cpuop_end();
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_4130_3)(uae_u32 opcode) /* CHK.L (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_1030_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -41872,17 +42365,16 @@ void REGPARAM2 CPUFUNC(op_4130_3)(uae_u32 opcode) /* CHK.L (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uaecptr oldpc = m68k_getpc();
-{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2003; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2003; }
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
-endlabel2003: ;
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_413b_3)(uae_u32 opcode) /* CHK.L (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_103b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -41890,18 +42382,17 @@ void REGPARAM2 CPUFUNC(op_413b_3)(uae_u32 opcode) /* CHK.L (d8,PC,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uaecptr oldpc = m68k_getpc();
-{	uaecptr tmppc = m68k_getpc() + 2;
+{{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2004; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2004; }
+{	uae_s8 src = get_byte(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
 }}}}m68k_incpc(4);
-endlabel2004: ;
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_41b0_3)(uae_u32 opcode) /* CHK.W (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_10b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -41914,17 +42405,17 @@ void REGPARAM2 CPUFUNC(op_41b0_3)(uae_u32 opcode) /* CHK.W (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uaecptr oldpc = m68k_getpc();
-{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2005; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2005; }
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
 }}}}m68k_incpc(4);
-endlabel2005: ;
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_41bb_3)(uae_u32 opcode) /* CHK.W (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_10bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -41932,19 +42423,18 @@ void REGPARAM2 CPUFUNC(op_41bb_3)(uae_u32 opcode) /* CHK.W (d8,PC,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uaecptr oldpc = m68k_getpc();
-{	uaecptr tmppc = m68k_getpc() + 2;
+{{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2006; }
-	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2006; }
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
 }}}}m68k_incpc(4);
-endlabel2006: ;
 	cpuop_end();
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_41f0_3)(uae_u32 opcode) /* LEA.L (d8,An,Xn),An */
+void REGPARAM2 CPUFUNC(op_10f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(An)+ */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -41958,14 +42448,17 @@ void REGPARAM2 CPUFUNC(op_41f0_3)(uae_u32 opcode) /* LEA.L (d8,An,Xn),An */
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	m68k_areg(regs, dstreg) = (srca);
-}}}m68k_incpc(4);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_41fb_3)(uae_u32 opcode) /* LEA.L (d8,PC,Xn),An */
+void REGPARAM2 CPUFUNC(op_10fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(An)+ */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -41975,13 +42468,17 @@ void REGPARAM2 CPUFUNC(op_41fb_3)(uae_u32 opcode) /* LEA.L (d8,PC,Xn),An */
 #endif
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	m68k_areg(regs, dstreg) = (srca);
-}}}m68k_incpc(4);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += areg_byteinc[dstreg];
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_4230_3)(uae_u32 opcode) /* CLR.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_1130_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),-(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -41989,34 +42486,43 @@ void REGPARAM2 CPUFUNC(op_4230_3)(uae_u32 opcode) /* CLR.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(0)) == 0);
-	SET_NFLG (((uae_s8)(0)) < 0);
-	put_byte(srca,0);
-}}m68k_incpc(4);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4270_3)(uae_u32 opcode) /* CLR.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_113b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),-(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - areg_byteinc[dstreg];
+	m68k_areg (regs, dstreg) = dsta;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(0)) == 0);
-	SET_NFLG (((uae_s16)(0)) < 0);
-	put_word(srca,0);
-}}m68k_incpc(4);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-#endif
-
-#ifdef PART_4
-void REGPARAM2 CPUFUNC(op_42b0_3)(uae_u32 opcode) /* CLR.L (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_1170_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d16,An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42024,55 +42530,41 @@ void REGPARAM2 CPUFUNC(op_42b0_3)(uae_u32 opcode) /* CLR.L (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(0)) == 0);
-	SET_NFLG (((uae_s32)(0)) < 0);
-	put_long(srca,0);
-}}m68k_incpc(4);
-	cpuop_end();
-}
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_42f0_3)(uae_u32 opcode) /* MVSR2.B (d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	MakeSR();
-	put_word(srca,regs.sr & 0xff);
-}}m68k_incpc(4);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_4430_3)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_117b_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d16,An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(0)) < 0;
-	int flgn = ((uae_s8)(dst)) < 0;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_byte(srca,dst);
-}}}}}}m68k_incpc(4);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_1180_3)(uae_u32 opcode) /* MOVE.B Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42080,45 +42572,21 @@ void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(0)) < 0;
-	int flgn = ((uae_s16)(dst)) < 0;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_word(srca,dst);
-}}}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(0)) < 0;
-	int flgn = ((uae_s32)(dst)) < 0;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_long(srca,dst);
-}}}}}}m68k_incpc(4);
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_44f0_3)(uae_u32 opcode) /* MV2SR.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_1190_3)(uae_u32 opcode) /* MOVE.B (An),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42126,47 +42594,22 @@ void REGPARAM2 CPUFUNC(op_44f0_3)(uae_u32 opcode) /* MV2SR.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-	MakeSR();
-	regs.sr &= 0xFF00;
-	regs.sr |= src & 0xFF;
-	MakeFromSR();
-}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_44fb_3)(uae_u32 opcode) /* MV2SR.B (d8,PC,Xn) */
-{
-	cpuop_begin();
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-	MakeSR();
-	regs.sr &= 0xFF00;
-	regs.sr |= src & 0xFF;
-	MakeFromSR();
-}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_4630_3)(uae_u32 opcode) /* NOT.B (d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s8 src = get_byte(srca);
-{	uae_u32 dst = ~src;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(dst)) == 0);
-	SET_NFLG (((uae_s8)(dst)) < 0);
-	put_byte(srca,dst);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4670_3)(uae_u32 opcode) /* NOT.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_1198_3)(uae_u32 opcode) /* MOVE.B (An)+,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42174,17 +42617,23 @@ void REGPARAM2 CPUFUNC(op_4670_3)(uae_u32 opcode) /* NOT.W (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_u32 dst = ~src;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s8 src = get_byte(srca);
+	m68k_areg(regs, srcreg) += areg_byteinc[srcreg];
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(dst)) == 0);
-	SET_NFLG (((uae_s16)(dst)) < 0);
-	put_word(srca,dst);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_46b0_3)(uae_u32 opcode) /* NOT.L (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_11a0_3)(uae_u32 opcode) /* MOVE.B -(An),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42192,17 +42641,23 @@ void REGPARAM2 CPUFUNC(op_46b0_3)(uae_u32 opcode) /* NOT.L (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_u32 dst = ~src;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - areg_byteinc[srcreg];
+{	uae_s8 src = get_byte(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(dst)) == 0);
-	SET_NFLG (((uae_s32)(dst)) < 0);
-	put_long(srca,dst);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
 }}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_46f0_3)(uae_u32 opcode) /* MV2SR.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_11a8_3)(uae_u32 opcode) /* MOVE.B (d16,An),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42210,29 +42665,22 @@ void REGPARAM2 CPUFUNC(op_46f0_3)(uae_u32 opcode) /* MV2SR.W (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{if (!regs.s) { Exception(8,0); goto endlabel2021; }
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-	regs.sr = src;
-	MakeFromSR();
-}}}}m68k_incpc(4);
-endlabel2021: ;
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_46fb_3)(uae_u32 opcode) /* MV2SR.W (d8,PC,Xn) */
-{
-	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel2022; }
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-	regs.sr = src;
-	MakeFromSR();
-}}}}m68k_incpc(4);
-endlabel2022: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4830_3)(uae_u32 opcode) /* NBCD.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_11b0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42240,95 +42688,113 @@ void REGPARAM2 CPUFUNC(op_4830_3)(uae_u32 opcode) /* NBCD.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
-{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
-	uae_u16 newv_hi = - (src & 0xF0);
-	uae_u16 newv;
-	int cflg;
-	if (newv_lo > 9) { newv_lo -= 6; }
-	newv = newv_hi + newv_lo;
-	cflg = (newv & 0x1F0) > 0x90;
-	if (cflg) newv -= 0x60;
-	SET_CFLG (cflg);
-	COPY_CARRY;
-	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
-	SET_NFLG (((uae_s8)(newv)) < 0);
-	put_byte(srca,newv);
-}}}}m68k_incpc(4);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_4870_3)(uae_u32 opcode) /* PEA.L (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_11b8_3)(uae_u32 opcode) /* MOVE.B (xxx).W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uaecptr dsta = m68k_areg(regs, 7) - 4;
-	m68k_areg (regs, 7) = dsta;
-	put_long(dsta,srca);
-}}}m68k_incpc(4);
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_487b_3)(uae_u32 opcode) /* PEA.L (d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_11b9_3)(uae_u32 opcode) /* MOVE.B (xxx).L,(d8,An,Xn) */
 {
 	cpuop_begin();
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uaecptr dsta = m68k_areg(regs, 7) - 4;
-	m68k_areg (regs, 7) = dsta;
-	put_long(dsta,srca);
-}}}m68k_incpc(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_ilong(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_48b0_3)(uae_u32 opcode) /* MVMLE.W #<data>.W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_11ba_3)(uae_u32 opcode) /* MOVE.B (d16,PC),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uae_u16 mask = get_iword(2);
-{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
-}}}m68k_incpc(6);
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-
+void REGPARAM2 CPUFUNC(op_11bb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_48f0_3)(uae_u32 opcode) /* MVMLE.L #<data>.W,(d8,An,Xn) */
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_11bc_3)(uae_u32 opcode) /* MOVE.B #<data>.B,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uae_u16 mask = get_iword(2);
-{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+{{	uae_s8 src = get_ibyte(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
 }}}m68k_incpc(6);
 	cpuop_end();
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_11f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).W */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42338,25 +42804,29 @@ void REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
-}}}m68k_incpc(4);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4a3b_3)(uae_u32 opcode) /* TST.B (d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_11fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).W */
 {
 	cpuop_begin();
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s8)(src)) == 0);
 	SET_NFLG (((uae_s8)(src)) < 0);
-}}}m68k_incpc(4);
+	put_byte(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_13f0_3)(uae_u32 opcode) /* MOVE.B (d8,An,Xn),(xxx).L */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42365,26 +42835,30 @@ void REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-}}}m68k_incpc(4);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4a7b_3)(uae_u32 opcode) /* TST.W (d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_13fb_3)(uae_u32 opcode) /* MOVE.B (d8,PC,Xn),(xxx).L */
 {
 	cpuop_begin();
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
+{	uae_s8 src = get_byte(srca);
+{	uaecptr dsta = get_ilong(4);
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-}}}m68k_incpc(4);
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(8);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_2030_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42392,27 +42866,40 @@ void REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
+{	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
-}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4abb_3)(uae_u32 opcode) /* TST.L (d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_203b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),Dn */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
-	CLEAR_CZNV;
+{	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
-}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_4af0_3)(uae_u32 opcode) /* TAS.B (d8,An,Xn) */
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_2070_3)(uae_u32 opcode) /* MOVEA.L (d8,An,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42420,88 +42907,82 @@ void REGPARAM2 CPUFUNC(op_4af0_3)(uae_u32 opcode) /* TAS.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	src |= 0x80;
-	put_byte(srca,src);
-}}}m68k_incpc(4);
-	cpuop_end();
-}
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_4cb0_3)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
-#endif
-{	uae_u16 mask = get_iword(2);
-	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
-}}}m68k_incpc(6);
-	cpuop_end();
-}
-
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_4cbb_3)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d8,PC,Xn) */
-{
-	cpuop_begin();
-	uae_u32 dstreg = 3;
-{	uae_u16 mask = get_iword(2);
-	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-{	uaecptr tmppc = m68k_getpc() + 4;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
-}}}m68k_incpc(6);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
 
 #endif
 #ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_4cf0_3)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_207b_3)(uae_u32 opcode) /* MOVEA.L (d8,PC,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uae_u16 mask = get_iword(2);
-	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
-}}}m68k_incpc(6);
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 val = src;
+	m68k_areg(regs, dstreg) = (val);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
 
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_4cfb_3)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_20b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An) */
 {
 	cpuop_begin();
-	uae_u32 dstreg = 3;
-{	uae_u16 mask = get_iword(2);
-	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
-{	uaecptr tmppc = m68k_getpc() + 4;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
-{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
-	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
-}}}m68k_incpc(6);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
+void REGPARAM2 CPUFUNC(op_20bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_4eb0_3)(uae_u32 opcode) /* JSR.L (d8,An,Xn) */
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_20f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(An)+ */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42509,25 +42990,43 @@ void REGPARAM2 CPUFUNC(op_4eb0_3)(uae_u32 opcode) /* JSR.L (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	m68k_do_jsr(m68k_getpc() + 4, srca);
-}}	cpuop_end();
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_4ebb_3)(uae_u32 opcode) /* JSR.L (d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_20fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(An)+ */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-	m68k_do_jsr(m68k_getpc() + 4, srca);
-}}	cpuop_end();
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_4ef0_3)(uae_u32 opcode) /* JMP.L (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_2130_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),-(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42535,115 +43034,110 @@ void REGPARAM2 CPUFUNC(op_4ef0_3)(uae_u32 opcode) /* JMP.L (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	m68k_setpc(srca);
-}}	cpuop_end();
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_4efb_3)(uae_u32 opcode) /* JMP.L (d8,PC,Xn) */
+void REGPARAM2 CPUFUNC(op_213b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),-(An) */
 {
 	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-	m68k_setpc(srca);
-}}	cpuop_end();
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 4;
+	m68k_areg (regs, dstreg) = dsta;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
 }
-
 #endif
-void REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
+
+#ifdef PART_3
+void REGPARAM2 CPUFUNC(op_2170_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d16,An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 srcreg = (opcode & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_u32 src = srcreg;
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-#endif
-
-#ifdef PART_5
-void REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_217b_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d16,An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
-#else
-	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_u32 src = srcreg;
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_2180_3)(uae_u32 opcode) /* MOVE.L Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 srcreg = (opcode & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_u32 src = srcreg;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s32 dst = get_long(dsta);
-{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(4);
 	cpuop_end();
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_50f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_2188_3)(uae_u32 opcode) /* MOVE.L An,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42651,103 +43145,92 @@ void REGPARAM2 CPUFUNC(op_50f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(0) ? 0xff : 0;
-	put_byte(srca,val);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s32 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
 }}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_2190_3)(uae_u32 opcode) /* MOVE.L (An),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 srcreg = (opcode & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_u32 src = srcreg;
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_2198_3)(uae_u32 opcode) /* MOVE.L (An)+,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 srcreg = (opcode & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_u32 src = srcreg;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21a0_3)(uae_u32 opcode) /* MOVE.L -(An),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+	uae_u32 srcreg = (opcode & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_u32 src = srcreg;
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 4;
+{	uae_s32 src = get_long(srca);
+	m68k_areg (regs, srcreg) = srca;
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s32 dst = get_long(dsta);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_51f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21a8_3)(uae_u32 opcode) /* MOVE.L (d16,An),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42755,33 +43238,22 @@ void REGPARAM2 CPUFUNC(op_51f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(1) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
-	cpuop_end();
-}
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_52f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(2) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_53f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21b0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42789,118 +43261,113 @@ void REGPARAM2 CPUFUNC(op_53f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(3) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
-	cpuop_end();
-}
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_54f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(4) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_55f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21b8_3)(uae_u32 opcode) /* MOVE.L (xxx).W,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(5) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_56f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21b9_3)(uae_u32 opcode) /* MOVE.L (xxx).L,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(6) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{{	uaecptr srca = get_ilong(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_57f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21ba_3)(uae_u32 opcode) /* MOVE.L (d16,PC),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(7) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_58f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21bb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(8) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_59f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21bc_3)(uae_u32 opcode) /* MOVE.L #<data>.L,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(9) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{{	uae_s32 src = get_ilong(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}m68k_incpc(8);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_5af0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).W */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42909,15 +43376,30 @@ void REGPARAM2 CPUFUNC(op_5af0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(10) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_5bf0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_21fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).W */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_23f0_3)(uae_u32 opcode) /* MOVE.L (d8,An,Xn),(xxx).L */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42926,15 +43408,30 @@ void REGPARAM2 CPUFUNC(op_5bf0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
 	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(11) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_5cf0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_23fb_3)(uae_u32 opcode) /* MOVE.L (d8,PC,Xn),(xxx).L */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(8);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_3030_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42942,16 +43439,40 @@ void REGPARAM2 CPUFUNC(op_5cf0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(12) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{	uae_s16 src = get_word(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
+void REGPARAM2 CPUFUNC(op_303b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
 #ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_5df0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_3070_3)(uae_u32 opcode) /* MOVEA.W (d8,An,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42959,33 +43480,40 @@ void REGPARAM2 CPUFUNC(op_5df0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(13) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
 
 #endif
 #ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_5ef0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_307b_3)(uae_u32 opcode) /* MOVEA.W (d8,PC,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(14) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 val = (uae_s32)(uae_s16)src;
+	m68k_areg(regs, dstreg) = (val);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
 
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_5ff0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_30b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -42993,318 +43521,3304 @@ void REGPARAM2 CPUFUNC(op_5ff0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	int val = cctrue(15) ? 0xff : 0;
-	put_byte(srca,val);
-}}}m68k_incpc(4);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#endif
-
-#ifdef PART_6
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_60ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_30bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An) */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(0)) goto endlabel2065;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2065;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(0)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2065: ;
-	cpuop_end();
-}
-
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_62ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
-{
-	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(2)) goto endlabel2066;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2066;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(2)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2066: ;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_63ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_30f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(An)+ */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(3)) goto endlabel2067;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2067;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(3)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2067: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_64ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_30fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(An)+ */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(4)) goto endlabel2068;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2068;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(4)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2068: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 2;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_65ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_3130_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),-(An) */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(5)) goto endlabel2069;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2069;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(5)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_313b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),-(An) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) - 2;
+	m68k_areg (regs, dstreg) = dsta;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_3170_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d16,An) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_317b_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d16,An) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = m68k_areg(regs, dstreg) + (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_3180_3)(uae_u32 opcode) /* MOVE.W Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_3188_3)(uae_u32 opcode) /* MOVE.W An,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = m68k_areg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_3190_3)(uae_u32 opcode) /* MOVE.W (An),(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_3198_3)(uae_u32 opcode) /* MOVE.W (An)+,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s16 src = get_word(srca);
+	m68k_areg(regs, srcreg) += 2;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31a0_3)(uae_u32 opcode) /* MOVE.W -(An),(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+{	uae_s16 src = get_word(srca);
+	m68k_areg (regs, srcreg) = srca;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31a8_3)(uae_u32 opcode) /* MOVE.W (d16,An),(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31b0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31b8_3)(uae_u32 opcode) /* MOVE.W (xxx).W,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31b9_3)(uae_u32 opcode) /* MOVE.W (xxx).L,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_ilong(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(6));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31ba_3)(uae_u32 opcode) /* MOVE.W (d16,PC),(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_getpc () + 2;
+	srca += (uae_s32)(uae_s16)get_iword(2);
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31bb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31bc_3)(uae_u32 opcode) /* MOVE.W #<data>.W,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).W */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_31fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).W */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = (uae_s32)(uae_s16)get_iword(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(6);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_33f0_3)(uae_u32 opcode) /* MOVE.W (d8,An,Xn),(xxx).L */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_33fb_3)(uae_u32 opcode) /* MOVE.W (d8,PC,Xn),(xxx).L */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uaecptr dsta = get_ilong(4);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(8);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4030_3)(uae_u32 opcode) /* NEGX.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4070_3)(uae_u32 opcode) /* NEGX.W (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s16)(newv)) == 0));
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	put_word(srca,newv);
+}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_40b0_3)(uae_u32 opcode) /* NEGX.L (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 newv = 0 - src - (GET_XFLG ? 1 : 0);
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_VFLG ((flgs ^ flgo) & (flgo ^ flgn));
+	SET_CFLG (flgs ^ ((flgs ^ flgn) & (flgo ^ flgn)));
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s32)(newv)) == 0));
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	put_long(srca,newv);
+}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_40f0_3)(uae_u32 opcode) /* MVSR2.W (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{if (!regs.s) { Exception(8,0); goto endlabel2102; }
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	MakeSR();
+	put_word(srca,regs.sr);
+}}}m68k_incpc(4);
+endlabel2102: ;
+	cpuop_end();
+}
+
+#endif
+void REGPARAM2 CPUFUNC(op_4130_3)(uae_u32 opcode) /* CHK.L (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2103; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2103; }
+}}}}m68k_incpc(4);
+endlabel2103: ;
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_413b_3)(uae_u32 opcode) /* CHK.L (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2104; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2104; }
+}}}}m68k_incpc(4);
+endlabel2104: ;
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_41b0_3)(uae_u32 opcode) /* CHK.W (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2105; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2105; }
+}}}}m68k_incpc(4);
+endlabel2105: ;
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_41bb_3)(uae_u32 opcode) /* CHK.W (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	if ((uae_s32)dst < 0) { SET_NFLG (1); Exception(6,oldpc); goto endlabel2106; }
+	else if (dst > src) { SET_NFLG (0); Exception(6,oldpc); goto endlabel2106; }
+}}}}m68k_incpc(4);
+endlabel2106: ;
+	cpuop_end();
+}
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_41f0_3)(uae_u32 opcode) /* LEA.L (d8,An,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_41fb_3)(uae_u32 opcode) /* LEA.L (d8,PC,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+void REGPARAM2 CPUFUNC(op_4230_3)(uae_u32 opcode) /* CLR.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(0)) == 0);
+	SET_NFLG (((uae_s8)(0)) < 0);
+	put_byte(srca,0);
+}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4270_3)(uae_u32 opcode) /* CLR.W (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(0)) == 0);
+	SET_NFLG (((uae_s16)(0)) < 0);
+	put_word(srca,0);
+}}m68k_incpc(4);
+	cpuop_end();
+}
+#endif
+
+#ifdef PART_4
+void REGPARAM2 CPUFUNC(op_42b0_3)(uae_u32 opcode) /* CLR.L (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(0)) == 0);
+	SET_NFLG (((uae_s32)(0)) < 0);
+	put_long(srca,0);
+}}m68k_incpc(4);
+	cpuop_end();
+}
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_42f0_3)(uae_u32 opcode) /* MVSR2.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	MakeSR();
+	put_word(srca,regs.sr & 0xff);
+}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+void REGPARAM2 CPUFUNC(op_4430_3)(uae_u32 opcode) /* NEG.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{{uae_u32 dst = ((uae_s8)(0)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(0)) < 0;
+	int flgn = ((uae_s8)(dst)) < 0;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(srca,dst);
+}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4470_3)(uae_u32 opcode) /* NEG.W (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{{uae_u32 dst = ((uae_s16)(0)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(0)) < 0;
+	int flgn = ((uae_s16)(dst)) < 0;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(srca,dst);
+}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_44b0_3)(uae_u32 opcode) /* NEG.L (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{{uae_u32 dst = ((uae_s32)(0)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(0)) < 0;
+	int flgn = ((uae_s32)(dst)) < 0;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(0)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(srca,dst);
+}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_44f0_3)(uae_u32 opcode) /* MV2SR.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_44fb_3)(uae_u32 opcode) /* MV2SR.B (d8,PC,Xn) */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+	MakeSR();
+	regs.sr &= 0xFF00;
+	regs.sr |= src & 0xFF;
+	MakeFromSR();
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4630_3)(uae_u32 opcode) /* NOT.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(dst)) == 0);
+	SET_NFLG (((uae_s8)(dst)) < 0);
+	put_byte(srca,dst);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4670_3)(uae_u32 opcode) /* NOT.W (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(dst)) == 0);
+	SET_NFLG (((uae_s16)(dst)) < 0);
+	put_word(srca,dst);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_46b0_3)(uae_u32 opcode) /* NOT.L (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_u32 dst = ~src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(dst)) == 0);
+	SET_NFLG (((uae_s32)(dst)) < 0);
+	put_long(srca,dst);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_46f0_3)(uae_u32 opcode) /* MV2SR.W (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{if (!regs.s) { Exception(8,0); goto endlabel2121; }
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel2121: ;
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_46fb_3)(uae_u32 opcode) /* MV2SR.W (d8,PC,Xn) */
+{
+	cpuop_begin();
+{if (!regs.s) { Exception(8,0); goto endlabel2122; }
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+	regs.sr = src;
+	MakeFromSR();
+}}}}m68k_incpc(4);
+endlabel2122: ;
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4830_3)(uae_u32 opcode) /* NBCD.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_u16 newv_lo = - (src & 0xF) - (GET_XFLG ? 1 : 0);
+	uae_u16 newv_hi = - (src & 0xF0);
+	uae_u16 newv;
+	int cflg;
+	if (newv_lo > 9) { newv_lo -= 6; }
+	newv = newv_hi + newv_lo;
+	cflg = (newv & 0x1F0) > 0x90;
+	if (cflg) newv -= 0x60;
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	SET_ZFLG (GET_ZFLG & (((uae_s8)(newv)) == 0));
+	SET_NFLG (((uae_s8)(newv)) < 0);
+	put_byte(srca,newv);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_4870_3)(uae_u32 opcode) /* PEA.L (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_487b_3)(uae_u32 opcode) /* PEA.L (d8,PC,Xn) */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uaecptr dsta = m68k_areg(regs, 7) - 4;
+	m68k_areg (regs, 7) = dsta;
+	put_long(dsta,srca);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_48b0_3)(uae_u32 opcode) /* MVMLE.W #<data>.W,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_word(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { put_word(srca, m68k_areg(regs, movem_index1[amask])); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_48f0_3)(uae_u32 opcode) /* MVMLE.L #<data>.W,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+	while (dmask) { put_long(srca, m68k_dreg(regs, movem_index1[dmask])); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { put_long(srca, m68k_areg(regs, movem_index1[amask])); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+void REGPARAM2 CPUFUNC(op_4a30_3)(uae_u32 opcode) /* TST.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a3b_3)(uae_u32 opcode) /* TST.B (d8,PC,Xn) */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a70_3)(uae_u32 opcode) /* TST.W (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4a7b_3)(uae_u32 opcode) /* TST.W (d8,PC,Xn) */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4ab0_3)(uae_u32 opcode) /* TST.L (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4abb_3)(uae_u32 opcode) /* TST.L (d8,PC,Xn) */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_4af0_3)(uae_u32 opcode) /* TAS.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	src |= 0x80;
+	put_byte(srca,src);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_4cb0_3)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_4cbb_3)(uae_u32 opcode) /* MVMEL.W #<data>.W,(d8,PC,Xn) */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 3;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = (uae_s32)(uae_s16)get_word(srca); srca += 2; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_4cf0_3)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_4cfb_3)(uae_u32 opcode) /* MVMEL.L #<data>.W,(d8,PC,Xn) */
+{
+	cpuop_begin();
+	uae_u32 dstreg = 3;
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr tmppc = m68k_getpc() + 4;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(4));
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+}}}m68k_incpc(6);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_4eb0_3)(uae_u32 opcode) /* JSR.L (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_4ebb_3)(uae_u32 opcode) /* JSR.L (d8,PC,Xn) */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+	m68k_do_jsr(m68k_getpc() + 4, srca);
+}}	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_4ef0_3)(uae_u32 opcode) /* JMP.L (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+	m68k_setpc(srca);
+}}	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_4efb_3)(uae_u32 opcode) /* JMP.L (d8,PC,Xn) */
+{
+	cpuop_begin();
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+	m68k_setpc(srca);
+}}	cpuop_end();
+}
+
+#endif
+void REGPARAM2 CPUFUNC(op_5030_3)(uae_u32 opcode) /* ADD.B #<data>,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#endif
+
+#ifdef PART_5
+void REGPARAM2 CPUFUNC(op_5070_3)(uae_u32 opcode) /* ADD.W #<data>,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_50b0_3)(uae_u32 opcode) /* ADD.L #<data>,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_50f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(0) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+void REGPARAM2 CPUFUNC(op_5130_3)(uae_u32 opcode) /* SUB.B #<data>,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_5170_3)(uae_u32 opcode) /* SUB.W #<data>,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_51b0_3)(uae_u32 opcode) /* SUB.L #<data>,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_51f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(1) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_52f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(2) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_53f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(3) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_54f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(4) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_55f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(5) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_56f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(6) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_57f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(7) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_58f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(8) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_59f0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(9) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_5af0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(10) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_5bf0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(11) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_5cf0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(12) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_5df0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(13) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_5ef0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(14) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_5ff0_3)(uae_u32 opcode) /* Scc.B (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	int val = cctrue(15) ? 0xff : 0;
+	put_byte(srca,val);
+}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#endif
+
+#ifdef PART_6
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_60ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(0)) goto endlabel2165;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2165;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(0)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2165: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_62ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(2)) goto endlabel2166;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2166;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(2)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2166: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_63ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(3)) goto endlabel2167;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2167;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(3)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2167: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_64ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(4)) goto endlabel2168;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2168;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(4)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2168: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_65ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(5)) goto endlabel2169;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2169;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(5)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2169: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_66ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(6)) goto endlabel2170;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2170;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2170: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_67ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(7)) goto endlabel2171;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2171;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(7)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2171: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_68ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(8)) goto endlabel2172;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2172;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(8)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2172: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_69ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(9)) goto endlabel2173;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2173;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(9)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2173: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_6aff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(10)) goto endlabel2174;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2174;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(10)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2174: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_6bff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(11)) goto endlabel2175;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2175;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(11)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2175: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_6cff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(12)) goto endlabel2176;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2176;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(12)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2176: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_6dff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(13)) goto endlabel2177;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2177;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(13)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2177: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_6eff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(14)) goto endlabel2178;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2178;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(14)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(6);
+endlabel2178: ;
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_6fff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+{
+	cpuop_begin();
+{	m68k_incpc(2);
+	if (!cctrue(15)) goto endlabel2179;
+		last_addr_for_exception_3 = m68k_getpc() + 2;
+		last_fault_for_exception_3 = m68k_getpc() + 1;
+		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2179;
+{	uae_s32 src = get_ilong(2);
+	if (!cctrue(15)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
 return;
 didnt_jump:;
 }}m68k_incpc(6);
-endlabel2069: ;
+endlabel2179: ;
+	cpuop_end();
+}
+
+#endif
+void REGPARAM2 CPUFUNC(op_8030_3)(uae_u32 opcode) /* OR.B (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_803b_3)(uae_u32 opcode) /* OR.B (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_8070_3)(uae_u32 opcode) /* OR.W (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_807b_3)(uae_u32 opcode) /* OR.W (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_80b0_3)(uae_u32 opcode) /* OR.L (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_80bb_3)(uae_u32 opcode) /* OR.L (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_80f0_3)(uae_u32 opcode) /* DIVU.W (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+m68k_incpc(4);
+	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2186; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}endlabel2186: ;
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_80fb_3)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+m68k_incpc(4);
+	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2187; } else {
+	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
+	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
+	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}endlabel2187: ;
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_8130_3)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_8170_3)(uae_u32 opcode) /* OR.W Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_81b0_3)(uae_u32 opcode) /* OR.L Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+	src |= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_81f0_3)(uae_u32 opcode) /* DIVS.W (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+m68k_incpc(4);
+	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2191; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}endlabel2191: ;
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_81fb_3)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{	uaecptr oldpc = m68k_getpc();
+{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+m68k_incpc(4);
+	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2192; } else {
+	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
+	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
+	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
+	{
+	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_NFLG (((uae_s16)(newv)) < 0);
+	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
+	m68k_dreg(regs, dstreg) = (newv);
+	}
+	}
+}}}}endlabel2192: ;
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_90f0_3)(uae_u32 opcode) /* SUBA.W (d8,An,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_90fb_3)(uae_u32 opcode) /* SUBA.W (d8,PC,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+void REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_91f0_3)(uae_u32 opcode) /* SUBA.L (d8,An,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_91fb_3)(uae_u32 opcode) /* SUBA.L (d8,PC,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst - src;
+	m68k_areg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+void REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+#endif
+
+#ifdef PART_7
+void REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b130_3)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b170_3)(uae_u32 opcode) /* EOR.W Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b1b0_3)(uae_u32 opcode) /* EOR.L Dn,(d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs != flgo) && (flgn != flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_NFLG (flgn != 0);
+}}}}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c030_3)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c03b_3)(uae_u32 opcode) /* AND.B (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s8 src = get_byte(srca);
+{	uae_s8 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c070_3)(uae_u32 opcode) /* AND.W (d8,An,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_c07b_3)(uae_u32 opcode) /* AND.W (d8,PC,Xn),Dn */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_66ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_c0b0_3)(uae_u32 opcode) /* AND.L (d8,An,Xn),Dn */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(6)) goto endlabel2070;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2070;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(6)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2070: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_67ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_c0bb_3)(uae_u32 opcode) /* AND.L (d8,PC,Xn),Dn */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(7)) goto endlabel2071;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2071;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(7)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2071: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_68ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_c0f0_3)(uae_u32 opcode) /* MULU.W (d8,An,Xn),Dn */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(8)) goto endlabel2072;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2072;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(8)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2072: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_69ff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_c0fb_3)(uae_u32 opcode) /* MULU.W (d8,PC,Xn),Dn */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(9)) goto endlabel2073;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2073;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(9)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2073: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_6aff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_c130_3)(uae_u32 opcode) /* AND.B Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(10)) goto endlabel2074;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2074;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(10)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2074: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s8 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s8 dst = get_byte(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s8)(src)) == 0);
+	SET_NFLG (((uae_s8)(src)) < 0);
+	put_byte(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_6bff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_c170_3)(uae_u32 opcode) /* AND.W Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(11)) goto endlabel2075;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2075;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(11)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2075: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s16 dst = get_word(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	put_word(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_6cff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_c1b0_3)(uae_u32 opcode) /* AND.L Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(12)) goto endlabel2076;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2076;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(12)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2076: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 1) & 7);
+#else
+	uae_u32 srcreg = ((opcode >> 9) & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
+{	uae_s32 dst = get_long(dsta);
+	src &= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_6dff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_c1f0_3)(uae_u32 opcode) /* MULS.W (d8,An,Xn),Dn */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(13)) goto endlabel2077;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2077;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(13)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2077: ;
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_6eff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
+void REGPARAM2 CPUFUNC(op_c1fb_3)(uae_u32 opcode) /* MULS.W (d8,PC,Xn),Dn */
 {
 	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(14)) goto endlabel2078;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2078;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(14)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2078: ;
-	cpuop_end();
-}
-
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_6fff_3)(uae_u32 opcode) /* Bcc.L #<data>.L */
-{
-	cpuop_begin();
-{	m68k_incpc(2);
-	if (!cctrue(15)) goto endlabel2079;
-		last_addr_for_exception_3 = m68k_getpc() + 2;
-		last_fault_for_exception_3 = m68k_getpc() + 1;
-		last_op_for_exception_3 = opcode; Exception(3,0); goto endlabel2079;
-{	uae_s32 src = get_ilong(2);
-	if (!cctrue(15)) goto didnt_jump;
-	m68k_incpc ((uae_s32)src + 2);
-return;
-didnt_jump:;
-}}m68k_incpc(6);
-endlabel2079: ;
+{{	uaecptr tmppc = m68k_getpc() + 2;
+	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
+{	uae_s16 src = get_word(srca);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_NFLG (((uae_s32)(newv)) < 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_8030_3)(uae_u32 opcode) /* OR.B (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43320,15 +46834,20 @@ void REGPARAM2 CPUFUNC(op_8030_3)(uae_u32 opcode) /* OR.B (d8,An,Xn),Dn */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
-}}}}m68k_incpc(4);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_803b_3)(uae_u32 opcode) /* OR.B (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43340,15 +46859,20 @@ void REGPARAM2 CPUFUNC(op_803b_3)(uae_u32 opcode) /* OR.B (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s8 src = get_byte(srca);
 {	uae_s8 dst = m68k_dreg(regs, dstreg);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
-}}}}m68k_incpc(4);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_8070_3)(uae_u32 opcode) /* OR.W (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43364,15 +46888,20 @@ void REGPARAM2 CPUFUNC(op_8070_3)(uae_u32 opcode) /* OR.W (d8,An,Xn),Dn */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
-}}}}m68k_incpc(4);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_807b_3)(uae_u32 opcode) /* OR.W (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43384,15 +46913,20 @@ void REGPARAM2 CPUFUNC(op_807b_3)(uae_u32 opcode) /* OR.W (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
 {	uae_s16 dst = m68k_dreg(regs, dstreg);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
-}}}}m68k_incpc(4);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_80b0_3)(uae_u32 opcode) /* OR.L (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43408,15 +46942,20 @@ void REGPARAM2 CPUFUNC(op_80b0_3)(uae_u32 opcode) /* OR.L (d8,An,Xn),Dn */
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (src);
-}}}}m68k_incpc(4);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_80bb_3)(uae_u32 opcode) /* OR.L (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43428,15 +46967,21 @@ void REGPARAM2 CPUFUNC(op_80bb_3)(uae_u32 opcode) /* OR.L (d8,PC,Xn),Dn */
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s32 src = get_long(srca);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (src);
-}}}}m68k_incpc(4);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_80f0_3)(uae_u32 opcode) /* DIVU.W (d8,An,Xn),Dn */
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_d0f0_3)(uae_u32 opcode) /* ADDA.W (d8,An,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43449,27 +46994,18 @@ void REGPARAM2 CPUFUNC(op_80f0_3)(uae_u32 opcode) /* DIVU.W (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uaecptr oldpc = m68k_getpc();
-{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2086; } else {
-	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
-	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
-	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
-	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
-	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
-	m68k_dreg(regs, dstreg) = (newv);
-	}
-	}
-}}}}endlabel2086: ;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_80fb_3)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_d0fb_3)(uae_u32 opcode) /* ADDA.W (d8,PC,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43477,28 +47013,18 @@ void REGPARAM2 CPUFUNC(op_80fb_3)(uae_u32 opcode) /* DIVU.W (d8,PC,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uaecptr oldpc = m68k_getpc();
-{	uaecptr tmppc = m68k_getpc() + 2;
+{{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
 {	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception (5, oldpc); goto endlabel2087; } else {
-	uae_u32 newv = (uae_u32)dst / (uae_u32)(uae_u16)src;
-	uae_u32 rem = (uae_u32)dst % (uae_u32)(uae_u16)src;
-	if (newv > 0xffff) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
-	{
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
-	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
-	m68k_dreg(regs, dstreg) = (newv);
-	}
-	}
-}}}}endlabel2087: ;
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_8130_3)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
+
+#endif
+void REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43514,15 +47040,20 @@ void REGPARAM2 CPUFUNC(op_8130_3)(uae_u32 opcode) /* OR.B Dn,(d8,An,Xn) */
 {{	uae_s8 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s8 dst = get_byte(dsta);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
+{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
+{	int flgs = ((uae_s8)(src)) < 0;
+	int flgo = ((uae_s8)(dst)) < 0;
+	int flgn = ((uae_s8)(newv)) < 0;
+	SET_ZFLG (((uae_s8)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_byte(dsta,newv);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_8170_3)(uae_u32 opcode) /* OR.W Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43538,15 +47069,20 @@ void REGPARAM2 CPUFUNC(op_8170_3)(uae_u32 opcode) /* OR.W Dn,(d8,An,Xn) */
 {{	uae_s16 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s16 dst = get_word(dsta);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(4);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_word(dsta,newv);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_81b0_3)(uae_u32 opcode) /* OR.L Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43562,15 +47098,24 @@ void REGPARAM2 CPUFUNC(op_81b0_3)(uae_u32 opcode) /* OR.L Dn,(d8,An,Xn) */
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
 {	uae_s32 dst = get_long(dsta);
-	src |= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	put_long(dsta,newv);
+}}}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_81f0_3)(uae_u32 opcode) /* DIVS.W (d8,An,Xn),Dn */
+#endif
+
+#ifdef PART_8
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_d1f0_3)(uae_u32 opcode) /* ADDA.L (d8,An,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43583,28 +47128,18 @@ void REGPARAM2 CPUFUNC(op_81f0_3)(uae_u32 opcode) /* DIVS.W (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uaecptr oldpc = m68k_getpc();
-{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2091; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
-	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
-	{
-	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
-	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
-	m68k_dreg(regs, dstreg) = (newv);
-	}
-	}
-}}}}endlabel2091: ;
+{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_81fb_3)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_d1fb_3)(uae_u32 opcode) /* ADDA.L (d8,PC,Xn),An */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43612,29 +47147,18 @@ void REGPARAM2 CPUFUNC(op_81fb_3)(uae_u32 opcode) /* DIVS.W (d8,PC,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{	uaecptr oldpc = m68k_getpc();
-{	uaecptr tmppc = m68k_getpc() + 2;
+{{	uaecptr tmppc = m68k_getpc() + 2;
 	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-m68k_incpc(4);
-	if (src == 0) { SET_VFLG (0); Exception(5,oldpc); goto endlabel2092; } else {
-	uae_s32 newv = (uae_s32)dst / (uae_s32)(uae_s16)src;
-	uae_u16 rem = (uae_s32)dst % (uae_s32)(uae_s16)src;
-	if ((newv & 0xffff8000) != 0 && (newv & 0xffff8000) != 0xffff8000) { SET_VFLG (1); SET_NFLG (1); SET_CFLG (0); } else
-	{
-	if (((uae_s16)rem < 0) != ((uae_s32)dst < 0)) rem = -rem;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_NFLG (((uae_s16)(newv)) < 0);
-	newv = (newv & 0xffff) | ((uae_u32)rem << 16);
-	m68k_dreg(regs, dstreg) = (newv);
-	}
-	}
-}}}}endlabel2092: ;
+{	uae_s32 src = get_long(srca);
+{	uae_s32 dst = m68k_areg(regs, dstreg);
+{	uae_u32 newv = dst + src;
+	m68k_areg(regs, dstreg) = (newv);
+}}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
+
+#endif
+void REGPARAM2 CPUFUNC(op_e0f0_3)(uae_u32 opcode) /* ASRW.W (d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43642,53 +47166,69 @@ void REGPARAM2 CPUFUNC(op_9030_3)(uae_u32 opcode) /* SUB.B (d8,An,Xn),Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 cflg = val & 1;
+	val = (val >> 1) | sign;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	SET_CFLG (cflg);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_e1f0_3)(uae_u32 opcode) /* ASLW.W (d8,An,Xn) */
+{
+	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 sign = 0x8000 & val;
+	uae_u32 sign2;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+	sign2 = 0x8000 & val;
+	SET_CFLG (sign != 0);
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+	SET_VFLG (GET_VFLG | (sign2 != sign));
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_903b_3)(uae_u32 opcode) /* SUB.B (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_e2f0_3)(uae_u32 opcode) /* LSRW.W (d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u32 val = (uae_u16)data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_e3f0_3)(uae_u32 opcode) /* LSLW.W (d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43696,53 +47236,89 @@ void REGPARAM2 CPUFUNC(op_9070_3)(uae_u32 opcode) /* SUB.W (d8,An,Xn),Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	COPY_CARRY;
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_e4f0_3)(uae_u32 opcode) /* ROXRW.W (d8,An,Xn) */
+{
+	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (GET_XFLG) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_907b_3)(uae_u32 opcode) /* SUB.W (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_e5f0_3)(uae_u32 opcode) /* ROXLW.W (d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (GET_XFLG) val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
 	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_e6f0_3)(uae_u32 opcode) /* RORW.W (d8,An,Xn) */
+{
+	cpuop_begin();
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 1;
+	val >>= 1;
+	if (carry) val |= 0x8000;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_e7f0_3)(uae_u32 opcode) /* ROLW.W (d8,An,Xn) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -43750,13 +47326,35 @@ void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{	uae_s16 data = get_word(dataa);
+{	uae_u16 val = data;
+	uae_u32 carry = val & 0x8000;
+	val <<= 1;
+	if (carry)  val |= 1;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(val)) == 0);
+	SET_NFLG (((uae_s16)(val)) < 0);
+SET_CFLG (carry >> 15);
+	put_word(dataa,val);
+}}}}m68k_incpc(4);
+	cpuop_end();
+}
+void REGPARAM2 CPUFUNC(op_fused_5180_6601_3)(uae_u32 opcode) /* SUB.L #<data>,Dn; Bcc.B #<data> */
+{
+	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
@@ -43768,152 +47366,173 @@ void REGPARAM2 CPUFUNC(op_90b0_3)(uae_u32 opcode) /* SUB.L (d8,An,Xn),Dn */
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2254: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_90bb_3)(uae_u32 opcode) /* SUB.L (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_d080_b180_3)(uae_u32 opcode) /* ADD.L Dn,Dn; EOR.L Dn,Dn */
 {
 	cpuop_begin();
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
-	cpuop_end();
+}}}}}}m68k_incpc(2);
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_90f0_3)(uae_u32 opcode) /* SUBA.W (d8,An,Xn),An */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{	uae_u32 newv = dst - src;
-	m68k_areg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_90fb_3)(uae_u32 opcode) /* SUBA.W (d8,PC,Xn),An */
+void REGPARAM2 CPUFUNC(op_fused_b180_5080_3)(uae_u32 opcode) /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{	uae_u32 newv = dst - src;
-	m68k_areg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
-	cpuop_end();
-}
-
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
 #endif
-void REGPARAM2 CPUFUNC(op_9130_3)(uae_u32 opcode) /* SUB.B Dn,(d8,An,Xn) */
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+#include "noflags_pop.h"
+}
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_9170_3)(uae_u32 opcode) /* SUB.W Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_5080_5180_3)(uae_u32 opcode) /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
-	cpuop_end();
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s32 dst = get_long(dsta);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
@@ -43923,57 +47542,43 @@ void REGPARAM2 CPUFUNC(op_91b0_3)(uae_u32 opcode) /* SUB.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_91f0_3)(uae_u32 opcode) /* SUBA.L (d8,An,Xn),An */
+void REGPARAM2 CPUFUNC(op_fused_5080_d080_3)(uae_u32 opcode) /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{	uae_u32 newv = dst - src;
-	m68k_areg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
-	cpuop_end();
-}
-
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_91fb_3)(uae_u32 opcode) /* SUBA.L (d8,PC,Xn),An */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{	uae_u32 newv = dst - src;
-	m68k_areg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -43984,49 +47589,60 @@ void REGPARAM2 CPUFUNC(op_b030_3)(uae_u32 opcode) /* CMP.B (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b03b_3)(uae_u32 opcode) /* CMP.B (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_d080_4e75_3)(uae_u32 opcode) /* ADD.L Dn,Dn; RTS.L  */
 {
 	cpuop_begin();
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s8)(dst)) - ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u8)(src)) > ((uae_u8)(dst)));
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+{	m68k_do_rts();
+}}
 	cpuop_end();
 }
-#endif
-
-#ifdef PART_7
-void REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_20d8_51c8_3)(uae_u32 opcode) /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -44037,96 +47653,87 @@ void REGPARAM2 CPUFUNC(op_b070_3)(uae_u32 opcode) /* CMP.W (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_b07b_3)(uae_u32 opcode) /* CMP.W (d8,PC,Xn),Dn */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s16)(dst)) - ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u16)(src)) > ((uae_u16)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2266: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0b0_3)(uae_u32 opcode) /* CMP.L (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_48e0_d080_3)(uae_u32 opcode) /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) - 0;
+{	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
+	opcode = GET_OPCODE;
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_b0bb_3)(uae_u32 opcode) /* CMP.L (d8,PC,Xn),Dn */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
+void REGPARAM2 CPUFUNC(op_fused_d080_4cd8_3)(uae_u32 opcode) /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -44137,118 +47744,139 @@ void REGPARAM2 CPUFUNC(op_b0f0_3)(uae_u32 opcode) /* CMPA.W (d8,An,Xn),An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
-	cpuop_end();
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_b0fb_3)(uae_u32 opcode) /* CMPA.W (d8,PC,Xn),An */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b130_3)(uae_u32 opcode) /* EOR.B Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_4cd8_5180_3)(uae_u32 opcode) /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 dstreg = opcode & 7;
+#endif
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
+#else
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b170_3)(uae_u32 opcode) /* EOR.W Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_640_5180_3)(uae_u32 opcode) /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
-#endif
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s16 dst = get_word(dsta);
-	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_b1b0_3)(uae_u32 opcode) /* EOR.L Dn,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s32 dst = get_long(dsta);
-	src ^= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
+void REGPARAM2 CPUFUNC(op_fused_d098_51c8_3)(uae_u32 opcode) /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -44259,46 +47887,92 @@ void REGPARAM2 CPUFUNC(op_b1f0_3)(uae_u32 opcode) /* CMPA.L (d8,An,Xn),An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
+{{	uaecptr srca = m68k_areg(regs, srcreg);
 {	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
 	int flgn = ((uae_s32)(newv)) < 0;
 	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2276: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_b1fb_3)(uae_u32 opcode) /* CMPA.L (d8,PC,Xn),An */
+void REGPARAM2 CPUFUNC(op_fused_41f9_303c_3)(uae_u32 opcode) /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
-{	int flgs = ((uae_s32)(src)) < 0;
-	int flgo = ((uae_s32)(dst)) < 0;
-	int flgn = ((uae_s32)(newv)) < 0;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_VFLG ((flgs != flgo) && (flgn != flgo));
-	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
-	SET_NFLG (flgn != 0);
-}}}}}}}m68k_incpc(4);
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c030_3)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_303c_20d8_3)(uae_u32 opcode) /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+#include "noflags_pop.h"
+}
+	opcode = GET_OPCODE;
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -44309,38 +47983,72 @@ void REGPARAM2 CPUFUNC(op_c030_3)(uae_u32 opcode) /* AND.B (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-	src &= dst;
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
-}}}}m68k_incpc(4);
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c03b_3)(uae_u32 opcode) /* AND.B (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_41f9_41f9_3)(uae_u32 opcode) /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((src) & 0xff);
-}}}}m68k_incpc(4);
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c070_3)(uae_u32 opcode) /* AND.W (d8,An,Xn),Dn */
+#endif
+
+
+#ifdef _MSC_VER
+#pragma warning(disable:4102)	/* unreferenced label */
+#endif
+
+#if !defined(PART_1) && !defined(PART_2) && !defined(PART_3) && !defined(PART_4) && !defined(PART_5) && !defined(PART_6) && !defined(PART_7) && !defined(PART_8)
+#define PART_1 1
+#define PART_2 1
+#define PART_3 1
+#define PART_4 1
+#define PART_5 1
+#define PART_6 1
+#define PART_7 1
+#define PART_8 1
+#endif
+
+#ifdef PART_1
+#endif
+
+#ifdef PART_2
+#endif
+
+#ifdef PART_3
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_40c0_4)(uae_u32 opcode) /* MVSR2.W Dn */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -44348,43 +48056,32 @@ void REGPARAM2 CPUFUNC(op_c070_3)(uae_u32 opcode) /* AND.W (d8,An,Xn),Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
-}}}}m68k_incpc(4);
+{{	MakeSR();
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((regs.sr) & 0xffff);
+}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c07b_3)(uae_u32 opcode) /* AND.W (d8,PC,Xn),Dn */
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_40d0_4)(uae_u32 opcode) /* MVSR2.W (An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
-}}}}m68k_incpc(4);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c0b0_3)(uae_u32 opcode) /* AND.L (d8,An,Xn),Dn */
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_40d8_4)(uae_u32 opcode) /* MVSR2.W (An)+ */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -44392,43 +48089,35 @@ void REGPARAM2 CPUFUNC(op_c0b0_3)(uae_u32 opcode) /* AND.L (d8,An,Xn),Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (src);
-}}}}m68k_incpc(4);
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+	m68k_areg(regs, srcreg) += 2;
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c0bb_3)(uae_u32 opcode) /* AND.L (d8,PC,Xn),Dn */
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_40e0_4)(uae_u32 opcode) /* MVSR2.W -(An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_dreg(regs, dstreg);
-	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(src)) == 0);
-	SET_NFLG (((uae_s32)(src)) < 0);
-	m68k_dreg(regs, dstreg) = (src);
-}}}}m68k_incpc(4);
+{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
+	m68k_areg (regs, srcreg) = srca;
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(2);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c0f0_3)(uae_u32 opcode) /* MULU.W (d8,An,Xn),Dn */
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_40e8_4)(uae_u32 opcode) /* MVSR2.W (d16,An) */
 {
 	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
@@ -44436,93 +48125,160 @@ void REGPARAM2 CPUFUNC(op_c0f0_3)(uae_u32 opcode) /* MULU.W (d8,An,Xn),Dn */
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
+{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(4);
+	cpuop_end();
+}
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_40f0_4)(uae_u32 opcode) /* MVSR2.W (d8,An,Xn) */
+{
+	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
 {{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
-	m68k_dreg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(4);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c0fb_3)(uae_u32 opcode) /* MULU.W (d8,PC,Xn),Dn */
+
+#endif
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_40f8_4)(uae_u32 opcode) /* MVSR2.W (xxx).W */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(4);
+	cpuop_end();
+}
+
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{	uae_u32 newv = (uae_u32)(uae_u16)dst * (uae_u32)(uae_u16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
-	m68k_dreg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
+#ifndef NOFLAGS
+void REGPARAM2 CPUFUNC(op_40f9_4)(uae_u32 opcode) /* MVSR2.W (xxx).L */
+{
+	cpuop_begin();
+{{	uaecptr srca = get_ilong(2);
+	MakeSR();
+	put_word(srca,regs.sr);
+}}m68k_incpc(6);
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c130_3)(uae_u32 opcode) /* AND.B Dn,(d8,An,Xn) */
+
+#endif
+#endif
+
+#ifdef PART_4
+void REGPARAM2 CPUFUNC(op_4e73_4)(uae_u32 opcode) /* RTE.L  */
+{
+	cpuop_begin();
+{if (!regs.s) { Exception(8,0); goto endlabel2291; }
+{{	uaecptr sra = m68k_areg(regs, 7);
+{	uae_s16 sr = get_word(sra);
+	m68k_areg(regs, 7) += 2;
+{	uaecptr pca = m68k_areg(regs, 7);
+{	uae_s32 pc = get_long(pca);
+	m68k_areg(regs, 7) += 4;
+	regs.sr = sr; m68k_setpc_rte(pc);
+	MakeFromSR();
+}}}}}}endlabel2291: ;
+	cpuop_end();
+}
+#endif
+
+#ifdef PART_5
+#endif
+
+#ifdef PART_6
+#endif
+
+#ifdef PART_7
+#endif
+
+#ifdef PART_8
+void REGPARAM2 CPUFUNC(op_fused_5180_6601_4)(uae_u32 opcode) /* SUB.L #<data>,Dn; Bcc.B #<data> */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s8)(src)) == 0);
-	SET_NFLG (((uae_s8)(src)) < 0);
-	put_byte(dsta,src);
-}}}}m68k_incpc(4);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = (uae_s32)(uae_s8)((opcode >> 8) & 255);
+#else
+	uae_u32 srcreg = (uae_s32)(uae_s8)(opcode & 255);
+#endif
+{{	uae_u32 src = srcreg;
+	if (!cctrue(6)) goto didnt_jump;
+	m68k_incpc ((uae_s32)src + 2);
+return;
+didnt_jump:;
+}}m68k_incpc(2);
+endlabel2293: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c170_3)(uae_u32 opcode) /* AND.W Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_d080_b180_4)(uae_u32 opcode) /* ADD.L Dn,Dn; EOR.L Dn,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = (opcode & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s16 dst = get_word(dsta);
-	src &= dst;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(src)) == 0);
-	SET_NFLG (((uae_s16)(src)) < 0);
-	put_word(dsta,src);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-void REGPARAM2 CPUFUNC(op_c1b0_3)(uae_u32 opcode) /* AND.L Dn,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
@@ -44534,171 +48290,159 @@ void REGPARAM2 CPUFUNC(op_c1b0_3)(uae_u32 opcode) /* AND.L Dn,(d8,An,Xn) */
 	uae_u32 dstreg = opcode & 7;
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s32 dst = get_long(dsta);
-	src &= dst;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
 	CLEAR_CZNV;
 	SET_ZFLG (((uae_s32)(src)) == 0);
 	SET_NFLG (((uae_s32)(src)) < 0);
-	put_long(dsta,src);
-}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_c1f0_3)(uae_u32 opcode) /* MULS.W (d8,An,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_b180_5080_4)(uae_u32 opcode) /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
-#else
-	uae_u32 srcreg = (opcode & 7);
-#endif
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = ((opcode >> 1) & 7);
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = ((opcode >> 9) & 7);
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
-	m68k_dreg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_c1fb_3)(uae_u32 opcode) /* MULS.W (d8,PC,Xn),Dn */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{	uae_u32 newv = (uae_s32)(uae_s16)dst * (uae_s32)(uae_s16)src;
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+	src ^= dst;
 	CLEAR_CZNV;
-	SET_ZFLG (((uae_s32)(newv)) == 0);
-	SET_NFLG (((uae_s32)(newv)) < 0);
-	m68k_dreg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
-	cpuop_end();
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (src);
+}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_d030_3)(uae_u32 opcode) /* ADD.B (d8,An,Xn),Dn */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_d03b_3)(uae_u32 opcode) /* ADD.B (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_5080_5180_4)(uae_u32 opcode) /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s8 src = get_byte(srca);
-{	uae_s8 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xff) | ((newv) & 0xff);
-}}}}}}}m68k_incpc(4);
-	cpuop_end();
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_d070_3)(uae_u32 opcode) /* ADD.W (d8,An,Xn),Dn */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_d07b_3)(uae_u32 opcode) /* ADD.W (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_5080_d080_4)(uae_u32 opcode) /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s16 dst = m68k_dreg(regs, dstreg);
-{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 8) & 7;
+#else
+	uae_u32 dstreg = opcode & 7;
+#endif
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
 	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
-}}}}}}}m68k_incpc(4);
-	cpuop_end();
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -44709,8 +48453,7 @@ void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
@@ -44722,20 +48465,25 @@ void REGPARAM2 CPUFUNC(op_d0b0_3)(uae_u32 opcode) /* ADD.L (d8,An,Xn),Dn */
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
+void REGPARAM2 CPUFUNC(op_fused_d080_4e75_4)(uae_u32 opcode) /* ADD.L Dn,Dn; RTS.L  */
 {
 	cpuop_begin();
+{
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 srcreg = ((opcode >> 8) & 7);
+#else
+	uae_u32 srcreg = (opcode & 7);
+#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
 {	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
@@ -44747,13 +48495,18 @@ void REGPARAM2 CPUFUNC(op_d0bb_3)(uae_u32 opcode) /* ADD.L (d8,PC,Xn),Dn */
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
 	m68k_dreg(regs, dstreg) = (newv);
-}}}}}}}m68k_incpc(4);
+}}}}}}m68k_incpc(2);
+}
+	opcode = GET_OPCODE;
+{
+{	m68k_do_rts();
+}}
 	cpuop_end();
 }
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_d0f0_3)(uae_u32 opcode) /* ADDA.W (d8,An,Xn),An */
+void REGPARAM2 CPUFUNC(op_fused_20d8_51c8_4)(uae_u32 opcode) /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -44764,110 +48517,69 @@ void REGPARAM2 CPUFUNC(op_d0f0_3)(uae_u32 opcode) /* ADDA.W (d8,An,Xn),An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{	uae_u32 newv = dst + src;
-	m68k_areg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
-	cpuop_end();
-}
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_d0fb_3)(uae_u32 opcode) /* ADDA.W (d8,PC,Xn),An */
-{
-	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
-#else
-	uae_u32 dstreg = (opcode >> 9) & 7;
-#endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s16 src = get_word(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{	uae_u32 newv = dst + src;
-	m68k_areg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_d130_3)(uae_u32 opcode) /* ADD.B Dn,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
-#endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uae_s8 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s8 dst = get_byte(dsta);
-{{uae_u32 newv = ((uae_s8)(dst)) + ((uae_s8)(src));
-{	int flgs = ((uae_s8)(src)) < 0;
-	int flgo = ((uae_s8)(dst)) < 0;
-	int flgn = ((uae_s8)(newv)) < 0;
-	SET_ZFLG (((uae_s8)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u8)(~dst)) < ((uae_u8)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_byte(dsta,newv);
-}}}}}}}m68k_incpc(4);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2305: ;
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_d170_3)(uae_u32 opcode) /* ADD.W Dn,(d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_48e0_d080_4)(uae_u32 opcode) /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
 {
 	cpuop_begin();
-#ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
-#else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
-#endif
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
 	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uae_s16 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s16 dst = get_word(dsta);
-{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
-{	int flgs = ((uae_s16)(src)) < 0;
-	int flgo = ((uae_s16)(dst)) < 0;
-	int flgn = ((uae_s16)(newv)) < 0;
-	SET_ZFLG (((uae_s16)(newv)) == 0);
-	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
-	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
-	COPY_CARRY;
-	SET_NFLG (flgn != 0);
-	put_word(dsta,newv);
-}}}}}}}m68k_incpc(4);
-	cpuop_end();
+{	uae_u16 mask = get_iword(2);
+{	uaecptr srca = m68k_areg(regs, dstreg) - 0;
+{	uae_u16 amask = mask & 0xff, dmask = (mask >> 8) & 0xff;
+	while (amask) { srca -= 4; put_long(srca, m68k_areg(regs, movem_index2[amask])); amask = movem_next[amask]; }
+	while (dmask) { srca -= 4; put_long(srca, m68k_dreg(regs, movem_index2[dmask])); dmask = movem_next[dmask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
 }
-void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 1) & 7);
+	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
-	uae_u32 srcreg = ((opcode >> 9) & 7);
+	uae_u32 srcreg = (opcode & 7);
 #endif
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 8) & 7;
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 dstreg = opcode & 7;
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
 {{	uae_s32 src = m68k_dreg(regs, srcreg);
-{	uaecptr dsta = get_disp_ea_000(m68k_areg(regs, dstreg), get_iword(2));
-{	uae_s32 dst = get_long(dsta);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
 {{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
 {	int flgs = ((uae_s32)(src)) < 0;
 	int flgo = ((uae_s32)(dst)) < 0;
@@ -44877,17 +48589,15 @@ void REGPARAM2 CPUFUNC(op_d1b0_3)(uae_u32 opcode) /* ADD.L Dn,(d8,An,Xn) */
 	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
 	COPY_CARRY;
 	SET_NFLG (flgn != 0);
-	put_long(dsta,newv);
-}}}}}}}m68k_incpc(4);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-#endif
-
-#ifdef PART_8
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_d1f0_3)(uae_u32 opcode) /* ADDA.L (d8,An,Xn),An */
+void REGPARAM2 CPUFUNC(op_fused_d080_4cd8_4)(uae_u32 opcode) /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
@@ -44898,399 +48608,283 @@ void REGPARAM2 CPUFUNC(op_d1f0_3)(uae_u32 opcode) /* ADDA.L (d8,An,Xn),An */
 #else
 	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{	uae_u32 newv = dst + src;
-	m68k_areg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uae_s32 src = m68k_dreg(regs, srcreg);
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_d1fb_3)(uae_u32 opcode) /* ADDA.L (d8,PC,Xn),An */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 dstreg = (opcode >> 1) & 7;
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 dstreg = (opcode >> 9) & 7;
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr tmppc = m68k_getpc() + 2;
-	uaecptr srca = get_disp_ea_000(tmppc, get_iword(2));
-{	uae_s32 src = get_long(srca);
-{	uae_s32 dst = m68k_areg(regs, dstreg);
-{	uae_u32 newv = dst + src;
-	m68k_areg(regs, dstreg) = (newv);
-}}}}}m68k_incpc(4);
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-
-#endif
-void REGPARAM2 CPUFUNC(op_e0f0_3)(uae_u32 opcode) /* ASRW.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_4cd8_5180_4)(uae_u32 opcode) /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 data = get_word(dataa);
-{	uae_u32 val = (uae_u16)data;
-	uae_u32 sign = 0x8000 & val;
-	uae_u32 cflg = val & 1;
-	val = (val >> 1) | sign;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
-	SET_CFLG (cflg);
-	COPY_CARRY;
-	put_word(dataa,val);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{	uae_u16 mask = get_iword(2);
+	unsigned int dmask = mask & 0xff, amask = (mask >> 8) & 0xff;
+{	uaecptr srca = m68k_areg(regs, dstreg);
+{	while (dmask) { m68k_dreg(regs, movem_index1[dmask]) = get_long(srca); srca += 4; dmask = movem_next[dmask]; }
+	while (amask) { m68k_areg(regs, movem_index1[amask]) = get_long(srca); srca += 4; amask = movem_next[amask]; }
+	m68k_areg(regs, dstreg) = srca;
+}}}m68k_incpc(4);
 }
-void REGPARAM2 CPUFUNC(op_e1f0_3)(uae_u32 opcode) /* ASLW.W (d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 data = get_word(dataa);
-{	uae_u32 val = (uae_u16)data;
-	uae_u32 sign = 0x8000 & val;
-	uae_u32 sign2;
-	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
-	sign2 = 0x8000 & val;
-	SET_CFLG (sign != 0);
-	COPY_CARRY;
-	SET_VFLG (GET_VFLG | (sign2 != sign));
-	put_word(dataa,val);
-}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_e2f0_3)(uae_u32 opcode) /* LSRW.W (d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 data = get_word(dataa);
-{	uae_u32 val = (uae_u16)data;
-	uae_u32 carry = val & 1;
-	val >>= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
-SET_CFLG (carry);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	put_word(dataa,val);
-}}}}m68k_incpc(4);
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_e3f0_3)(uae_u32 opcode) /* LSLW.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_640_5180_4)(uae_u32 opcode) /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 data = get_word(dataa);
-{	uae_u16 val = data;
-	uae_u32 carry = val & 0x8000;
-	val <<= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
-SET_CFLG (carry >> 15);
+{{	uae_s16 src = get_iword(2);
+{	uae_s16 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s16)(dst)) + ((uae_s16)(src));
+{	int flgs = ((uae_s16)(src)) < 0;
+	int flgo = ((uae_s16)(dst)) < 0;
+	int flgn = ((uae_s16)(newv)) < 0;
+	SET_ZFLG (((uae_s16)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u16)(~dst)) < ((uae_u16)(src)));
 	COPY_CARRY;
-	put_word(dataa,val);
-}}}}m68k_incpc(4);
-	cpuop_end();
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((newv) & 0xffff);
+}}}}}}m68k_incpc(4);
+#include "noflags_pop.h"
 }
-void REGPARAM2 CPUFUNC(op_e4f0_3)(uae_u32 opcode) /* ROXRW.W (d8,An,Xn) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 1) & 7)];
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 srcreg = imm8_table[((opcode >> 9) & 7)];
 #endif
-{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 data = get_word(dataa);
-{	uae_u16 val = data;
-	uae_u32 carry = val & 1;
-	val >>= 1;
-	if (GET_XFLG) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
-SET_CFLG (carry);
-	COPY_CARRY;
-	put_word(dataa,val);
-}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_e5f0_3)(uae_u32 opcode) /* ROXLW.W (d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 8) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = opcode & 7;
 #endif
-{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 data = get_word(dataa);
-{	uae_u16 val = data;
-	uae_u32 carry = val & 0x8000;
-	val <<= 1;
-	if (GET_XFLG) val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
-SET_CFLG (carry >> 15);
+{{	uae_u32 src = srcreg;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) - ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgo) & (flgn ^ flgo));
+	SET_CFLG (((uae_u32)(src)) > ((uae_u32)(dst)));
 	COPY_CARRY;
-	put_word(dataa,val);
-}}}}m68k_incpc(4);
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-void REGPARAM2 CPUFUNC(op_e6f0_3)(uae_u32 opcode) /* RORW.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_d098_51c8_4)(uae_u32 opcode) /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 data = get_word(dataa);
-{	uae_u16 val = data;
-	uae_u32 carry = val & 1;
-	val >>= 1;
-	if (carry) val |= 0x8000;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
-SET_CFLG (carry);
-	put_word(dataa,val);
-}}}}m68k_incpc(4);
-	cpuop_end();
-}
-void REGPARAM2 CPUFUNC(op_e7f0_3)(uae_u32 opcode) /* ROLW.W (d8,An,Xn) */
-{
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr dataa = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-{	uae_s16 data = get_word(dataa);
-{	uae_u16 val = data;
-	uae_u32 carry = val & 0x8000;
-	val <<= 1;
-	if (carry)  val |= 1;
-	CLEAR_CZNV;
-	SET_ZFLG (((uae_s16)(val)) == 0);
-	SET_NFLG (((uae_s16)(val)) < 0);
-SET_CFLG (carry >> 15);
-	put_word(dataa,val);
-}}}}m68k_incpc(4);
-	cpuop_end();
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uae_s32 dst = m68k_dreg(regs, dstreg);
+{{uae_u32 newv = ((uae_s32)(dst)) + ((uae_s32)(src));
+{	int flgs = ((uae_s32)(src)) < 0;
+	int flgo = ((uae_s32)(dst)) < 0;
+	int flgn = ((uae_s32)(newv)) < 0;
+	SET_ZFLG (((uae_s32)(newv)) == 0);
+	SET_VFLG ((flgs ^ flgn) & (flgo ^ flgn));
+	SET_CFLG (((uae_u32)(~dst)) < ((uae_u32)(src)));
+	COPY_CARRY;
+	SET_NFLG (flgn != 0);
+	m68k_dreg(regs, dstreg) = (newv);
+}}}}}}}m68k_incpc(2);
 }
-#endif
-
-
-#ifdef _MSC_VER
-#pragma warning(disable:4102)	/* unreferenced label */
-#endif
-
-#if !defined(PART_1) && !defined(PART_2) && !defined(PART_3) && !defined(PART_4) && !defined(PART_5) && !defined(PART_6) && !defined(PART_7) && !defined(PART_8)
-#define PART_1 1
-#define PART_2 1
-#define PART_3 1
-#define PART_4 1
-#define PART_5 1
-#define PART_6 1
-#define PART_7 1
-#define PART_8 1
-#endif
-
-#ifdef PART_1
-#endif
-
-#ifdef PART_2
-#endif
-
-#ifdef PART_3
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_40c0_4)(uae_u32 opcode) /* MVSR2.W Dn */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	MakeSR();
-	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | ((regs.sr) & 0xffff);
-}}m68k_incpc(2);
+{{	uae_s16 src = m68k_dreg(regs, srcreg);
+{	uae_s16 offs = get_iword(2);
+	if (!cctrue(1)) {
+	m68k_dreg(regs, srcreg) = (m68k_dreg(regs, srcreg) & ~0xffff) | (((src-1)) & 0xffff);
+		if (src) {
+			m68k_incpc((uae_s32)offs + 2);
+return;
+		}
+	}
+}}}m68k_incpc(4);
+endlabel2315: ;
+}
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_40d0_4)(uae_u32 opcode) /* MVSR2.W (An) */
+void REGPARAM2 CPUFUNC(op_fused_41f9_303c_4)(uae_u32 opcode) /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-	MakeSR();
-	put_word(srca,regs.sr);
-}}m68k_incpc(2);
-	cpuop_end();
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_40d8_4)(uae_u32 opcode) /* MVSR2.W (An)+ */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg);
-	m68k_areg(regs, srcreg) += 2;
-	MakeSR();
-	put_word(srca,regs.sr);
-}}m68k_incpc(2);
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+}
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_40e0_4)(uae_u32 opcode) /* MVSR2.W -(An) */
+void REGPARAM2 CPUFUNC(op_fused_303c_20d8_4)(uae_u32 opcode) /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
 {
 	cpuop_begin();
+{
+#include "noflags_push.h"
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) - 2;
-	m68k_areg (regs, srcreg) = srca;
-	MakeSR();
-	put_word(srca,regs.sr);
-}}m68k_incpc(2);
-	cpuop_end();
+{{	uae_s16 src = get_iword(2);
+{	CLEAR_CZNV;
+	SET_ZFLG (((uae_s16)(src)) == 0);
+	SET_NFLG (((uae_s16)(src)) < 0);
+	m68k_dreg(regs, dstreg) = (m68k_dreg(regs, dstreg) & ~0xffff) | ((src) & 0xffff);
+}}}m68k_incpc(4);
+#include "noflags_pop.h"
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_40e8_4)(uae_u32 opcode) /* MVSR2.W (d16,An) */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
 #ifdef HAVE_GET_WORD_UNSWAPPED
 	uae_u32 srcreg = ((opcode >> 8) & 7);
 #else
 	uae_u32 srcreg = (opcode & 7);
 #endif
-{{	uaecptr srca = m68k_areg(regs, srcreg) + (uae_s32)(uae_s16)get_iword(2);
-	MakeSR();
-	put_word(srca,regs.sr);
-}}m68k_incpc(4);
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
+#endif
+{{	uaecptr srca = m68k_areg(regs, srcreg);
+{	uae_s32 src = get_long(srca);
+	m68k_areg(regs, srcreg) += 4;
+{	uaecptr dsta = m68k_areg(regs, dstreg);
+	m68k_areg(regs, dstreg) += 4;
+	CLEAR_CZNV;
+	SET_ZFLG (((uae_s32)(src)) == 0);
+	SET_NFLG (((uae_s32)(src)) < 0);
+	put_long(dsta,src);
+}}}}m68k_incpc(2);
+}
 	cpuop_end();
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_40f0_4)(uae_u32 opcode) /* MVSR2.W (d8,An,Xn) */
+void REGPARAM2 CPUFUNC(op_fused_41f9_41f9_4)(uae_u32 opcode) /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
 {
 	cpuop_begin();
+{
 #ifdef HAVE_GET_WORD_UNSWAPPED
-	uae_u32 srcreg = ((opcode >> 8) & 7);
+	uae_u32 dstreg = (opcode >> 1) & 7;
 #else
-	uae_u32 srcreg = (opcode & 7);
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-{{	uaecptr srca = get_disp_ea_000(m68k_areg(regs, srcreg), get_iword(2));
-	MakeSR();
-	put_word(srca,regs.sr);
-}}m68k_incpc(4);
-	cpuop_end();
+{{	uaecptr srca = get_ilong(2);
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-
-#endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_40f8_4)(uae_u32 opcode) /* MVSR2.W (xxx).W */
+	opcode = GET_OPCODE;
 {
-	cpuop_begin();
-{{	uaecptr srca = (uae_s32)(uae_s16)get_iword(2);
-	MakeSR();
-	put_word(srca,regs.sr);
-}}m68k_incpc(4);
-	cpuop_end();
-}
-
+#ifdef HAVE_GET_WORD_UNSWAPPED
+	uae_u32 dstreg = (opcode >> 1) & 7;
+#else
+	uae_u32 dstreg = (opcode >> 9) & 7;
 #endif
-#ifndef NOFLAGS
-void REGPARAM2 CPUFUNC(op_40f9_4)(uae_u32 opcode) /* MVSR2.W (xxx).L */
-{
-	cpuop_begin();
 {{	uaecptr srca = get_ilong(2);
-	MakeSR();
-	put_word(srca,regs.sr);
-}}m68k_incpc(6);
-	cpuop_end();
+{	m68k_areg(regs, dstreg) = (srca);
+}}}m68k_incpc(6);
 }
-
-#endif
-#endif
-
-#ifdef PART_4
-void REGPARAM2 CPUFUNC(op_4e73_4)(uae_u32 opcode) /* RTE.L  */
-{
-	cpuop_begin();
-{if (!regs.s) { Exception(8,0); goto endlabel2161; }
-{{	uaecptr sra = m68k_areg(regs, 7);
-{	uae_s16 sr = get_word(sra);
-	m68k_areg(regs, 7) += 2;
-{	uaecptr pca = m68k_areg(regs, 7);
-{	uae_s32 pc = get_long(pca);
-	m68k_areg(regs, 7) += 4;
-	regs.sr = sr; m68k_setpc_rte(pc);
-	MakeFromSR();
-}}}}}}endlabel2161: ;
 	cpuop_end();
 }
 #endif
 
-#ifdef PART_5
-#endif
-
-#ifdef PART_6
-#endif
-
-#ifdef PART_7
-#endif
-
-#ifdef PART_8
-#endif
-
@@ -1884,6 +1884,26 @@ struct cputbl CPUFUNC(op_smalltbl_0)[] = {
 { CPUFUNC_FF(op_f618_0), 0, 63000 }, /* MOVE16.L (xxx).L,(An) */
 { CPUFUNC_FF(op_f620_0), 0, 63008 }, /* MOVE16.L (An)+,(An)+ */
 { 0, 0, 0 }};
+struct cpufusedtbl CPUFUNC(op_fusedtbl_0)[] = {
+{ CPUFUNC(op_fused_5180_6601_0), 20864, 26113 }, /* SUB.L #<data>,Dn; Bcc.B #<data> */
+{ CPUFUNC(op_fused_d080_b180_0), 53376, 45440 }, /* ADD.L Dn,Dn; EOR.L Dn,Dn */
+{ CPUFUNC(op_fused_b180_5080_0), 45440, 20608 }, /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_5180_0), 20608, 20864 }, /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_d080_0), 20608, 53376 }, /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_f200_f200_0), 61952, 61952 }, /* FPP.L #<data>.W,Dn; FPP.L #<data>.W,Dn */
+{ CPUFUNC(op_fused_d080_4e75_0), 53376, 20085 }, /* ADD.L Dn,Dn; RTS.L  */
+{ CPUFUNC(op_fused_20d8_51c8_0), 8408, 20936 }, /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_48e0_d080_0), 18656, 53376 }, /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_d080_4cd8_0), 53376, 19672 }, /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
+{ CPUFUNC(op_fused_4cd8_5180_0), 19672, 20864 }, /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_f200_5180_0), 61952, 20864 }, /* FPP.L #<data>.W,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_33c0_f438_0), 13248, 62520 }, /* MOVE.W Dn,(xxx).L; CPUSHA.L #<data> */
+{ CPUFUNC(op_fused_640_5180_0), 1600, 20864 }, /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_d098_51c8_0), 53400, 20936 }, /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_41f9_303c_0), 16889, 12348 }, /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
+{ CPUFUNC(op_fused_303c_20d8_0), 12348, 8408 }, /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
+{ CPUFUNC(op_fused_41f9_41f9_0), 16889, 16889 }, /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
+{ 0, 0, 0 }};
 struct cputbl CPUFUNC(op_smalltbl_1)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
@@ -3728,6 +3748,25 @@ struct cputbl CPUFUNC(op_smalltbl_1)[] = {
 { CPUFUNC_FF(op_f37a_0), 0, 62330 }, /* FRESTORE.L (d16,PC) */
 { CPUFUNC_FF(op_f37b_0), 0, 62331 }, /* FRESTORE.L (d8,PC,Xn) */
 { 0, 0, 0 }};
+struct cpufusedtbl CPUFUNC(op_fusedtbl_1)[] = {
+{ CPUFUNC(op_fused_5180_6601_1), 20864, 26113 }, /* SUB.L #<data>,Dn; Bcc.B #<data> */
+{ CPUFUNC(op_fused_d080_b180_1), 53376, 45440 }, /* ADD.L Dn,Dn; EOR.L Dn,Dn */
+{ CPUFUNC(op_fused_b180_5080_1), 45440, 20608 }, /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_5180_1), 20608, 20864 }, /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_d080_1), 20608, 53376 }, /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_f200_f200_1), 61952, 61952 }, /* FPP.L #<data>.W,Dn; FPP.L #<data>.W,Dn */
+{ CPUFUNC(op_fused_d080_4e75_1), 53376, 20085 }, /* ADD.L Dn,Dn; RTS.L  */
+{ CPUFUNC(op_fused_20d8_51c8_1), 8408, 20936 }, /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_48e0_d080_1), 18656, 53376 }, /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_d080_4cd8_1), 53376, 19672 }, /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
+{ CPUFUNC(op_fused_4cd8_5180_1), 19672, 20864 }, /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_f200_5180_1), 61952, 20864 }, /* FPP.L #<data>.W,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_640_5180_1), 1600, 20864 }, /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_d098_51c8_1), 53400, 20936 }, /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_41f9_303c_1), 16889, 12348 }, /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
+{ CPUFUNC(op_fused_303c_20d8_1), 12348, 8408 }, /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
+{ CPUFUNC(op_fused_41f9_41f9_1), 16889, 16889 }, /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
+{ 0, 0, 0 }};
 struct cputbl CPUFUNC(op_smalltbl_2)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
@@ -5532,6 +5571,23 @@ struct cputbl CPUFUNC(op_smalltbl_2)[] = {
 { CPUFUNC(op_eff8_0), 0, 61432 }, /* BFINS.L #<data>.W,(xxx).W */
 { CPUFUNC(op_eff9_0), 0, 61433 }, /* BFINS.L #<data>.W,(xxx).L */
 { 0, 0, 0 }};
+struct cpufusedtbl CPUFUNC(op_fusedtbl_2)[] = {
+{ CPUFUNC(op_fused_5180_6601_2), 20864, 26113 }, /* SUB.L #<data>,Dn; Bcc.B #<data> */
+{ CPUFUNC(op_fused_d080_b180_2), 53376, 45440 }, /* ADD.L Dn,Dn; EOR.L Dn,Dn */
+{ CPUFUNC(op_fused_b180_5080_2), 45440, 20608 }, /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_5180_2), 20608, 20864 }, /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_d080_2), 20608, 53376 }, /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_d080_4e75_2), 53376, 20085 }, /* ADD.L Dn,Dn; RTS.L  */
+{ CPUFUNC(op_fused_20d8_51c8_2), 8408, 20936 }, /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_48e0_d080_2), 18656, 53376 }, /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_d080_4cd8_2), 53376, 19672 }, /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
+{ CPUFUNC(op_fused_4cd8_5180_2), 19672, 20864 }, /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_640_5180_2), 1600, 20864 }, /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_d098_51c8_2), 53400, 20936 }, /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_41f9_303c_2), 16889, 12348 }, /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
+{ CPUFUNC(op_fused_303c_20d8_2), 12348, 8408 }, /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
+{ CPUFUNC(op_fused_41f9_41f9_2), 16889, 16889 }, /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
+{ 0, 0, 0 }};
 struct cputbl CPUFUNC(op_smalltbl_3)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
@@ -7130,6 +7186,23 @@ struct cputbl CPUFUNC(op_smalltbl_3)[] = {
 { CPUFUNC(op_e7f8_0), 0, 59384 }, /* ROLW.W (xxx).W */
 { CPUFUNC(op_e7f9_0), 0, 59385 }, /* ROLW.W (xxx).L */
 { 0, 0, 0 }};
+struct cpufusedtbl CPUFUNC(op_fusedtbl_3)[] = {
+{ CPUFUNC(op_fused_5180_6601_3), 20864, 26113 }, /* SUB.L #<data>,Dn; Bcc.B #<data> */
+{ CPUFUNC(op_fused_d080_b180_3), 53376, 45440 }, /* ADD.L Dn,Dn; EOR.L Dn,Dn */
+{ CPUFUNC(op_fused_b180_5080_3), 45440, 20608 }, /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_5180_3), 20608, 20864 }, /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_d080_3), 20608, 53376 }, /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_d080_4e75_3), 53376, 20085 }, /* ADD.L Dn,Dn; RTS.L  */
+{ CPUFUNC(op_fused_20d8_51c8_3), 8408, 20936 }, /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_48e0_d080_3), 18656, 53376 }, /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_d080_4cd8_3), 53376, 19672 }, /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
+{ CPUFUNC(op_fused_4cd8_5180_3), 19672, 20864 }, /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_640_5180_3), 1600, 20864 }, /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_d098_51c8_3), 53400, 20936 }, /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_41f9_303c_3), 16889, 12348 }, /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
+{ CPUFUNC(op_fused_303c_20d8_3), 12348, 8408 }, /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
+{ CPUFUNC(op_fused_41f9_41f9_3), 16889, 16889 }, /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
+{ 0, 0, 0 }};
 struct cputbl CPUFUNC(op_smalltbl_4)[] = {
 { CPUFUNC(op_0_0), 0, 0 }, /* OR.B #<data>.B,Dn */
 { CPUFUNC(op_10_0), 0, 16 }, /* OR.B #<data>.B,(An) */
@@ -8718,3 +8791,20 @@ struct cputbl CPUFUNC(op_smalltbl_4)[] = {
 { CPUFUNC(op_e7f8_0), 0, 59384 }, /* ROLW.W (xxx).W */
 { CPUFUNC(op_e7f9_0), 0, 59385 }, /* ROLW.W (xxx).L */
 { 0, 0, 0 }};
+struct cpufusedtbl CPUFUNC(op_fusedtbl_4)[] = {
+{ CPUFUNC(op_fused_5180_6601_4), 20864, 26113 }, /* SUB.L #<data>,Dn; Bcc.B #<data> */
+{ CPUFUNC(op_fused_d080_b180_4), 53376, 45440 }, /* ADD.L Dn,Dn; EOR.L Dn,Dn */
+{ CPUFUNC(op_fused_b180_5080_4), 45440, 20608 }, /* EOR.L Dn,Dn; ADD.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_5180_4), 20608, 20864 }, /* ADD.L #<data>,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_5080_d080_4), 20608, 53376 }, /* ADD.L #<data>,Dn; ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_d080_4e75_4), 53376, 20085 }, /* ADD.L Dn,Dn; RTS.L  */
+{ CPUFUNC(op_fused_20d8_51c8_4), 8408, 20936 }, /* MOVE.L (An)+,(An)+; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_48e0_d080_4), 18656, 53376 }, /* MVMLE.L #<data>.W,-(An); ADD.L Dn,Dn */
+{ CPUFUNC(op_fused_d080_4cd8_4), 53376, 19672 }, /* ADD.L Dn,Dn; MVMEL.L #<data>.W,(An)+ */
+{ CPUFUNC(op_fused_4cd8_5180_4), 19672, 20864 }, /* MVMEL.L #<data>.W,(An)+; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_640_5180_4), 1600, 20864 }, /* ADD.W #<data>.W,Dn; SUB.L #<data>,Dn */
+{ CPUFUNC(op_fused_d098_51c8_4), 53400, 20936 }, /* ADD.L (An)+,Dn; DBcc.W Dn,#<data>.W */
+{ CPUFUNC(op_fused_41f9_303c_4), 16889, 12348 }, /* LEA.L (xxx).L,An; MOVE.W #<data>.W,Dn */
+{ CPUFUNC(op_fused_303c_20d8_4), 12348, 8408 }, /* MOVE.W #<data>.W,Dn; MOVE.L (An)+,(An)+ */
+{ CPUFUNC(op_fused_41f9_41f9_4), 16889, 16889 }, /* LEA.L (xxx).L,An; LEA.L (xxx).L,An */
+{ 0, 0, 0 }};
@@ -3734,6 +3734,42 @@ extern cpuop_func op_f618_0_nf;
 extern cpuop_func op_f618_0_ff;
 extern cpuop_func op_f620_0_nf;
 extern cpuop_func op_f620_0_ff;
+extern cpuop_func op_fused_5180_6601_0_nf;
+extern cpuop_func op_fused_5180_6601_0_ff;
+extern cpuop_func op_fused_d080_b180_0_nf;
+extern cpuop_func op_fused_d080_b180_0_ff;
+extern cpuop_func op_fused_b180_5080_0_nf;
+extern cpuop_func op_fused_b180_5080_0_ff;
+extern cpuop_func op_fused_5080_5180_0_nf;
+extern cpuop_func op_fused_5080_5180_0_ff;
+extern cpuop_func op_fused_5080_d080_0_nf;
+extern cpuop_func op_fused_5080_d080_0_ff;
+extern cpuop_func op_fused_f200_f200_0_nf;
+extern cpuop_func op_fused_f200_f200_0_ff;
+extern cpuop_func op_fused_d080_4e75_0_nf;
+extern cpuop_func op_fused_d080_4e75_0_ff;
+extern cpuop_func op_fused_20d8_51c8_0_nf;
+extern cpuop_func op_fused_20d8_51c8_0_ff;
+extern cpuop_func op_fused_48e0_d080_0_nf;
+extern cpuop_func op_fused_48e0_d080_0_ff;
+extern cpuop_func op_fused_d080_4cd8_0_nf;
+extern cpuop_func op_fused_d080_4cd8_0_ff;
+extern cpuop_func op_fused_4cd8_5180_0_nf;
+extern cpuop_func op_fused_4cd8_5180_0_ff;
+extern cpuop_func op_fused_f200_5180_0_nf;
+extern cpuop_func op_fused_f200_5180_0_ff;
+extern cpuop_func op_fused_33c0_f438_0_nf;
+extern cpuop_func op_fused_33c0_f438_0_ff;
+extern cpuop_func op_fused_640_5180_0_nf;
+extern cpuop_func op_fused_640_5180_0_ff;
+extern cpuop_func op_fused_d098_51c8_0_nf;
+extern cpuop_func op_fused_d098_51c8_0_ff;
+extern cpuop_func op_fused_41f9_303c_0_nf;
+extern cpuop_func op_fused_41f9_303c_0_ff;
+extern cpuop_func op_fused_303c_20d8_0_nf;
+extern cpuop_func op_fused_303c_20d8_0_ff;
+extern cpuop_func op_fused_41f9_41f9_0_nf;
+extern cpuop_func op_fused_41f9_41f9_0_ff;
 extern cpuop_func op_4800_1_nf;
 extern cpuop_func op_4800_1_ff;
 extern cpuop_func op_4810_1_nf;
@@ -3758,6 +3794,70 @@ extern cpuop_func op_c100_1_nf;
 extern cpuop_func op_c100_1_ff;
 extern cpuop_func op_c108_1_nf;
 extern cpuop_func op_c108_1_ff;
+extern cpuop_func op_fused_5180_6601_1_nf;
+extern cpuop_func op_fused_5180_6601_1_ff;
+extern cpuop_func op_fused_d080_b180_1_nf;
+extern cpuop_func op_fused_d080_b180_1_ff;
+extern cpuop_func op_fused_b180_5080_1_nf;
+extern cpuop_func op_fused_b180_5080_1_ff;
+extern cpuop_func op_fused_5080_5180_1_nf;
+extern cpuop_func op_fused_5080_5180_1_ff;
+extern cpuop_func op_fused_5080_d080_1_nf;
+extern cpuop_func op_fused_5080_d080_1_ff;
+extern cpuop_func op_fused_f200_f200_1_nf;
+extern cpuop_func op_fused_f200_f200_1_ff;
+extern cpuop_func op_fused_d080_4e75_1_nf;
+extern cpuop_func op_fused_d080_4e75_1_ff;
+extern cpuop_func op_fused_20d8_51c8_1_nf;
+extern cpuop_func op_fused_20d8_51c8_1_ff;
+extern cpuop_func op_fused_48e0_d080_1_nf;
+extern cpuop_func op_fused_48e0_d080_1_ff;
+extern cpuop_func op_fused_d080_4cd8_1_nf;
+extern cpuop_func op_fused_d080_4cd8_1_ff;
+extern cpuop_func op_fused_4cd8_5180_1_nf;
+extern cpuop_func op_fused_4cd8_5180_1_ff;
+extern cpuop_func op_fused_f200_5180_1_nf;
+extern cpuop_func op_fused_f200_5180_1_ff;
+extern cpuop_func op_fused_640_5180_1_nf;
+extern cpuop_func op_fused_640_5180_1_ff;
+extern cpuop_func op_fused_d098_51c8_1_nf;
+extern cpuop_func op_fused_d098_51c8_1_ff;
+extern cpuop_func op_fused_41f9_303c_1_nf;
+extern cpuop_func op_fused_41f9_303c_1_ff;
+extern cpuop_func op_fused_303c_20d8_1_nf;
+extern cpuop_func op_fused_303c_20d8_1_ff;
+extern cpuop_func op_fused_41f9_41f9_1_nf;
+extern cpuop_func op_fused_41f9_41f9_1_ff;
+extern cpuop_func op_fused_5180_6601_2_nf;
+extern cpuop_func op_fused_5180_6601_2_ff;
+extern cpuop_func op_fused_d080_b180_2_nf;
+extern cpuop_func op_fused_d080_b180_2_ff;
+extern cpuop_func op_fused_b180_5080_2_nf;
+extern cpuop_func op_fused_b180_5080_2_ff;
+extern cpuop_func op_fused_5080_5180_2_nf;
+extern cpuop_func op_fused_5080_5180_2_ff;
+extern cpuop_func op_fused_5080_d080_2_nf;
+extern cpuop_func op_fused_5080_d080_2_ff;
+extern cpuop_func op_fused_d080_4e75_2_nf;
+extern cpuop_func op_fused_d080_4e75_2_ff;
+extern cpuop_func op_fused_20d8_51c8_2_nf;
+extern cpuop_func op_fused_20d8_51c8_2_ff;
+extern cpuop_func op_fused_48e0_d080_2_nf;
+extern cpuop_func op_fused_48e0_d080_2_ff;
+extern cpuop_func op_fused_d080_4cd8_2_nf;
+extern cpuop_func op_fused_d080_4cd8_2_ff;
+extern cpuop_func op_fused_4cd8_5180_2_nf;
+extern cpuop_func op_fused_4cd8_5180_2_ff;
+extern cpuop_func op_fused_640_5180_2_nf;
+extern cpuop_func op_fused_640_5180_2_ff;
+extern cpuop_func op_fused_d098_51c8_2_nf;
+extern cpuop_func op_fused_d098_51c8_2_ff;
+extern cpuop_func op_fused_41f9_303c_2_nf;
+extern cpuop_func op_fused_41f9_303c_2_ff;
+extern cpuop_func op_fused_303c_20d8_2_nf;
+extern cpuop_func op_fused_303c_20d8_2_ff;
+extern cpuop_func op_fused_41f9_41f9_2_nf;
+extern cpuop_func op_fused_41f9_41f9_2_ff;
 extern cpuop_func op_30_3_nf;
 extern cpuop_func op_30_3_ff;
 extern cpuop_func op_70_3_nf;
@@ -4302,6 +4402,36 @@ extern cpuop_func op_e6f0_3_nf;
 extern cpuop_func op_e6f0_3_ff;
 extern cpuop_func op_e7f0_3_nf;
 extern cpuop_func op_e7f0_3_ff;
+extern cpuop_func op_fused_5180_6601_3_nf;
+extern cpuop_func op_fused_5180_6601_3_ff;
+extern cpuop_func op_fused_d080_b180_3_nf;
+extern cpuop_func op_fused_d080_b180_3_ff;
+extern cpuop_func op_fused_b180_5080_3_nf;
+extern cpuop_func op_fused_b180_5080_3_ff;
+extern cpuop_func op_fused_5080_5180_3_nf;
+extern cpuop_func op_fused_5080_5180_3_ff;
+extern cpuop_func op_fused_5080_d080_3_nf;
+extern cpuop_func op_fused_5080_d080_3_ff;
+extern cpuop_func op_fused_d080_4e75_3_nf;
+extern cpuop_func op_fused_d080_4e75_3_ff;
+extern cpuop_func op_fused_20d8_51c8_3_nf;
+extern cpuop_func op_fused_20d8_51c8_3_ff;
+extern cpuop_func op_fused_48e0_d080_3_nf;
+extern cpuop_func op_fused_48e0_d080_3_ff;
+extern cpuop_func op_fused_d080_4cd8_3_nf;
+extern cpuop_func op_fused_d080_4cd8_3_ff;
+extern cpuop_func op_fused_4cd8_5180_3_nf;
+extern cpuop_func op_fused_4cd8_5180_3_ff;
+extern cpuop_func op_fused_640_5180_3_nf;
+extern cpuop_func op_fused_640_5180_3_ff;
+extern cpuop_func op_fused_d098_51c8_3_nf;
+extern cpuop_func op_fused_d098_51c8_3_ff;
+extern cpuop_func op_fused_41f9_303c_3_nf;
+extern cpuop_func op_fused_41f9_303c_3_ff;
+extern cpuop_func op_fused_303c_20d8_3_nf;
+extern cpuop_func op_fused_303c_20d8_3_ff;
+extern cpuop_func op_fused_41f9_41f9_3_nf;
+extern cpuop_func op_fused_41f9_41f9_3_ff;
 extern cpuop_func op_40c0_4_nf;
 extern cpuop_func op_40c0_4_ff;
 extern cpuop_func op_40d0_4_nf;
@@ -4320,3 +4450,33 @@ extern cpuop_func op_40f9_4_nf;
 extern cpuop_func op_40f9_4_ff;
 extern cpuop_func op_4e73_4_nf;
 extern cpuop_func op_4e73_4_ff;
+extern cpuop_func op_fused_5180_6601_4_nf;
+extern cpuop_func op_fused_5180_6601_4_ff;
+extern cpuop_func op_fused_d080_b180_4_nf;
+extern cpuop_func op_fused_d080_b180_4_ff;
+extern cpuop_func op_fused_b180_5080_4_nf;
+extern cpuop_func op_fused_b180_5080_4_ff;
+extern cpuop_func op_fused_5080_5180_4_nf;
+extern cpuop_func op_fused_5080_5180_4_ff;
+extern cpuop_func op_fused_5080_d080_4_nf;
+extern cpuop_func op_fused_5080_d080_4_ff;
+extern cpuop_func op_fused_d080_4e75_4_nf;
+extern cpuop_func op_fused_d080_4e75_4_ff;
+extern cpuop_func op_fused_20d8_51c8_4_nf;
+extern cpuop_func op_fused_20d8_51c8_4_ff;
+extern cpuop_func op_fused_48e0_d080_4_nf;
+extern cpuop_func op_fused_48e0_d080_4_ff;
+extern cpuop_func op_fused_d080_4cd8_4_nf;
+extern cpuop_func op_fused_d080_4cd8_4_ff;
+extern cpuop_func op_fused_4cd8_5180_4_nf;
+extern cpuop_func op_fused_4cd8_5180_4_ff;
+extern cpuop_func op_fused_640_5180_4_nf;
+extern cpuop_func op_fused_640_5180_4_ff;
+extern cpuop_func op_fused_d098_51c8_4_nf;
+extern cpuop_func op_fused_d098_51c8_4_ff;
+extern cpuop_func op_fused_41f9_303c_4_nf;
+extern cpuop_func op_fused_41f9_303c_4_ff;
+extern cpuop_func op_fused_303c_20d8_4_nf;
+extern cpuop_func op_fused_303c_20d8_4_ff;
+extern cpuop_func op_fused_41f9_41f9_4_nf;
+extern cpuop_func op_fused_41f9_41f9_4_ff;
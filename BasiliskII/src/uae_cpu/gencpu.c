@@ -65,6 +65,46 @@ static int *opcode_next_clev;
 static int *opcode_last_postfix;
 static unsigned long *counts;
 
+/* Pairs of instructions that get a fused handler, the most frequent ones
+ * first. They are read from the "Pairs:" section of frequent.68k, which
+ * newcpu.cpp writes when built with COUNT_INSTRS == 2. The one in uae_cpu/
+ * was made by running the cpubench kernels, not MacOS, so it only stands
+ * in until a profile of real MacOS code replaces it.  */
+#define MAX_FUSED_PAIRS 64
+static int nr_fused_pairs;
+static unsigned long fused_pairs[MAX_FUSED_PAIRS][2];
+
+static int can_fuse (unsigned long first, unsigned long second)
+{
+    if (first > 0xffff || second > 0xffff)
+	return 0;
+    if (table68k[first].mnemo == i_ILLG || table68k[first].handler != -1
+	|| table68k[second].mnemo == i_ILLG || table68k[second].handler != -1)
+	return 0;
+    /* The first instruction has to fall through to the second one, without
+       having to check for special conditions in between */
+    if (table68k[first].cflow & (fl_end_block | fl_trap))
+	return 0;
+    return 1;
+}
+
+static void read_pairs (FILE *file)
+{
+    unsigned long first, second, count, total;
+
+    nr_fused_pairs = 0;
+    if (fscanf (file, "Pairs: %lu\n", &total) != 1)
+	return;
+    while (nr_fused_pairs < MAX_FUSED_PAIRS
+	   && fscanf (file, "%lx %lx: %lu\n", &first, &second, &count) == 3) {
+	if (!can_fuse (first, second))
+	    continue;
+	fused_pairs[nr_fused_pairs][0] = first;
+	fused_pairs[nr_fused_pairs][1] = second;
+	nr_fused_pairs++;
+    }
+}
+
 static void read_counts (void)
 {
     FILE *file;
@@ -74,6 +114,9 @@ static void read_counts (void)
     memset (counts, 0, 65536 * sizeof *counts);
 
     file = fopen ("frequent.68k", "r");
+    if (!file)
+	/* The pair profile that comes with the sources, run from Unix/ or Windows/ */
+	file = fopen ("../uae_cpu/frequent.68k", "r");
     if (file) {
 	fscanf (file, "Total: %lu\n", &total);
 	while (fscanf (file, "%lx: %lu %s\n", &opcode, &count, name) == 3) {
@@ -82,6 +125,7 @@ static void read_counts (void)
 	    opcode_map[nr++] = opcode;
 	    counts[opcode] = count;
 	}
+	read_pairs (file);
 	fclose (file);
     }
     if (nr == nr_cpuop_funcs)
@@ -2279,9 +2323,10 @@ static void generate_includes (FILE * f)
 
 static int postfix;
 
+static void gen_opcode_body (long int opcode);
+
 static void generate_one_opcode (int rp)
 {
-    uae_u16 smsk, dmsk;
     long int opcode = opcode_map[rp];
     const char *opcode_str;
 
@@ -2324,6 +2369,21 @@ static void generate_one_opcode (int rp)
 	printf ("void REGPARAM2 CPUFUNC(op_%lx_%d)(uae_u32 opcode) /* %s */\n{\n", opcode, postfix, opcode_str);
 	printf ("\tcpuop_begin();\n");
 
+    next_cpu_level = -1;
+    gen_opcode_body (opcode);
+	printf ("\tcpuop_end();\n");
+    printf ("}\n");
+	if (table68k[opcode].flagdead == 0)
+	printf ("\n#endif\n");
+    opcode_next_clev[rp] = next_cpu_level;
+    opcode_last_postfix[rp] = postfix;
+}
+
+/* Decode the register fields of OPCODE and emit its code */
+static void gen_opcode_body (long int opcode)
+{
+    uae_u16 smsk, dmsk;
+
     switch (table68k[opcode].stype) {
      case 0: smsk = 7; break;
      case 1: smsk = 255; break;
@@ -2337,7 +2397,6 @@ static void generate_one_opcode (int rp)
     }
     dmsk = 7;
 
-    next_cpu_level = -1;
     if (table68k[opcode].suse
 	&& table68k[opcode].smode != imm && table68k[opcode].smode != imm0
 	&& table68k[opcode].smode != imm1 && table68k[opcode].smode != imm2
@@ -2443,12 +2502,91 @@ static void generate_one_opcode (int rp)
     gen_opcode (opcode);
     if (need_endlabel)
 	printf ("%s: ;\n", endlabelstr);
+}
+
+/* Whether the first instruction of a fused pair can leave the flags alone,
+ * because the second one sets all of them again without reading them */
+static int fused_first_noflags (unsigned long first, unsigned long second)
+{
+    struct instr *a = table68k + first, *b = table68k + second;
+
+    if (a->flagdead <= 0 || b->flagdead < 0 || b->flaglive < 0)
+	return 0;
+    /* Exceptions save the SR */
+    if (b->cflow & fl_trap)
+	return 0;
+    /* These use the flags they set themselves (see noflags.h) */
+    switch (a->mnemo) {
+     case i_CAS: case i_CAS2: case i_CHK2:
+     case i_BFTST: case i_BFEXTU: case i_BFCHG: case i_BFEXTS:
+     case i_BFCLR: case i_BFFFO: case i_BFSET: case i_BFINS:
+	return 0;
+     default:
+	break;
+    }
+    return (a->flagdead & ~b->flagdead) == 0 && (a->flagdead & b->flaglive) == 0;
+}
+
+static int fused_pair_at_level (int i)
+{
+    return table68k[fused_pairs[i][0]].clev <= (unsigned)cpu_level
+	&& table68k[fused_pairs[i][1]].clev <= (unsigned)cpu_level;
+}
+
+static void generate_fused (void)
+{
+    char first_str[100], second_str[100];
+    int i;
+
+    for (i = 0; i < nr_fused_pairs; i++) {
+	unsigned long first = fused_pairs[i][0], second = fused_pairs[i][1];
+	int noflags;
+
+	if (!fused_pair_at_level (i))
+	    continue;
+
+	strcpy (first_str, get_instruction_string (first));
+	strcpy (second_str, get_instruction_string (second));
+	noflags = fused_first_noflags (first, second);
+
+	fprintf (headerfile, "extern cpuop_func op_fused_%lx_%lx_%d_nf;\n", first, second, postfix);
+	fprintf (headerfile, "extern cpuop_func op_fused_%lx_%lx_%d_ff;\n", first, second, postfix);
+
+	printf ("void REGPARAM2 CPUFUNC(op_fused_%lx_%lx_%d)(uae_u32 opcode) /* %s; %s */\n{\n",
+		first, second, postfix, first_str, second_str);
+	printf ("\tcpuop_begin();\n");
+	printf ("{\n");
+	if (noflags)
+	    printf ("#include \"noflags_push.h\"\n");
+	gen_opcode_body (first);
+	if (noflags)
+	    printf ("#include \"noflags_pop.h\"\n");
+	printf ("}\n");
+	printf ("\topcode = GET_OPCODE;\n");
+	printf ("{\n");
+	gen_opcode_body (second);
+	printf ("}\n");
 	printf ("\tcpuop_end();\n");
-    printf ("}\n");
-	if (table68k[opcode].flagdead == 0)
-	printf ("\n#endif\n");
-    opcode_next_clev[rp] = next_cpu_level;
-    opcode_last_postfix[rp] = postfix;
+	printf ("}\n");
+    }
+}
+
+static void generate_fusedtbl (void)
+{
+    int i;
+
+    fprintf (stblfile, "struct cpufusedtbl CPUFUNC(op_fusedtbl_%d)[] = {\n", postfix);
+    for (i = 0; i < nr_fused_pairs; i++) {
+	unsigned long first = fused_pairs[i][0], second = fused_pairs[i][1];
+
+	if (!fused_pair_at_level (i))
+	    continue;
+
+	fprintf (stblfile, "{ CPUFUNC(op_fused_%lx_%lx_%d), %ld, %ld },", first, second, postfix, first, second);
+	fprintf (stblfile, " /* %s;", get_instruction_string (first));
+	fprintf (stblfile, " %s */\n", get_instruction_string (second));
+    }
+    fprintf (stblfile, "{ 0, 0, 0 }};\n");
 }
 
 static void generate_func (void)
@@ -2504,10 +2642,14 @@ static void generate_func (void)
 		printf ("#ifdef PART_%d\n",j);
 		for (; rp < k; rp++)
 		   generate_one_opcode (rp);
+		if (j == 8 && !using_prefetch)
+		   generate_fused ();
 		printf ("#endif\n\n");
 	}
 
 	fprintf (stblfile, "{ 0, 0, 0 }};\n");
+	if (!using_prefetch)
+	    generate_fusedtbl ();
     }
 }
 
@@ -28,9 +28,13 @@
 
 #include "cpu_emulation.h"
 #include "main.h"
+#include "prefs.h"
 #include "emul_op.h"
+#include "timer.h"
 
 extern int intlev(void);	// From baisilisk_glue.cpp
+extern bool idle_detect_interrupt(uaecptr pc);
+extern bool idle_detect_check(uaecptr pc);
 
 #include "m68k.h"
 #include "memory.h"
@@ -39,7 +43,7 @@ extern int intlev(void);	// From baisilisk_glue.cpp
 #include "compiler/compemu.h"
 #include "fpu/fpu.h"
 
-#if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
+#if SPCFLAGS_USE_LOCK
 B2_mutex *spcflags_lock = NULL;
 #endif
 
@@ -61,6 +65,31 @@ int movem_index2[256];
 int movem_next[256];
 
 cpuop_func *cpufunctbl[65536];
+static cpuop_func *cpufunctbl_nf[65536];	// Handlers that don't set flags
+
+/* Handlers for pairs of instructions, by pair of table68k handler
+   indices, in a hash table */
+const int FUSED_PAIRS_SIZE = 256;	// A power of 2, well above the number of pairs
+
+struct fused_pair {
+	uae_u32 pair;
+	cpuop_func *handler;
+};
+
+static fused_pair fused_pairs[FUSED_PAIRS_SIZE];
+
+static inline uae_u32 fused_pair_hash (uae_u32 pair)
+{
+	return (pair * 0x9e3779b1) >> (32 - 8);
+}
+
+struct predecoded_block;
+static predecoded_block *predecode_cache = NULL;
+static bool use_predecode = false;	// Flag: run through the predecoding interpreter
+
+#ifdef USE_CPU_EMUL_TICKS
+bool cpu_count_ticks = false;		// Flag: count emulated instructions with cpu_check_ticks()
+#endif
 
 #if FLIGHT_RECORDER
 struct rec_step {
@@ -132,6 +161,9 @@ static void dump_regs(void)
 }
 #endif
 
+/* 1: count executed opcodes, 2: count instruction handlers and pairs of
+   them, for gencpu to generate fused handlers from. Counting is done by
+   the plain interpreter, not by the predecoding one nor by the JIT */
 #define COUNT_INSTRS 0
 
 #if COUNT_INSTRS
@@ -143,7 +175,40 @@ static int compfn (const void *el1, const void *el2)
 	return instrcount[*(const uae_u16 *)el1] < instrcount[*(const uae_u16 *)el2];
 }
 
-static char *icountfilename (void)
+#if COUNT_INSTRS == 2
+/* Counts of pairs of handlers executed in sequence, in a hash table */
+const int PAIRCOUNT_SIZE = 65536;
+
+struct paircount {
+	uae_u32 pair;
+	unsigned long int count;
+};
+
+static paircount paircounts[PAIRCOUNT_SIZE];
+static uae_u32 last_counted = 0xffffffff;	// No previous handler
+
+static void count_pair (uae_u32 pair, unsigned long int n)
+{
+	uae_u32 h = (pair * 0x9e3779b1) >> 16;
+	for (int i = 0; i < 16; i++, h = (h + 1) & (PAIRCOUNT_SIZE - 1)) {
+		if (paircounts[h].count == 0)
+			paircounts[h].pair = pair;
+		if (paircounts[h].pair == pair) {
+			paircounts[h].count += n;
+			return;
+		}
+	}
+}
+
+static int paircompfn (const void *el1, const void *el2)
+{
+	unsigned long int c1 = ((const paircount *)el1)->count;
+	unsigned long int c2 = ((const paircount *)el2)->count;
+	return c1 < c2 ? 1 : c1 > c2 ? -1 : 0;
+}
+#endif
+
+static const char *icountfilename (void)
 {
 	char *name = getenv ("INSNCOUNT");
 	if (name)
@@ -154,7 +219,7 @@ static char *icountfilename (void)
 void dump_counts (void)
 {
 	FILE *f = fopen (icountfilename (), "w");
-	unsigned long int total;
+	unsigned long int total = 0;
 	int i;
 
 	write_log ("Writing instruction count file...\n");
@@ -176,6 +241,15 @@ void dump_counts (void)
 			;
 		fprintf (f, "%04x: %lu %s\n", opcodenums[i], cnt, lookup->name);
 	}
+#if COUNT_INSTRS == 2
+	qsort (paircounts, PAIRCOUNT_SIZE, sizeof(paircount), paircompfn);
+	total = 0;
+	for (i = 0; i < PAIRCOUNT_SIZE; i++)
+		total += paircounts[i].count;
+	fprintf (f, "Pairs: %lu\n", total);
+	for (i = 0; i < PAIRCOUNT_SIZE && paircounts[i].count; i++)
+		fprintf (f, "%04x %04x: %lu\n", paircounts[i].pair >> 16, paircounts[i].pair & 0xffff, paircounts[i].count);
+#endif
 	fclose (f);
 }
 #else
@@ -195,6 +269,23 @@ static __inline__ unsigned int cft_map (unsigned int f)
 #endif
 }
 
+#if COUNT_INSTRS
+static inline void count_instr (uae_u32 opcode)
+{
+	uae_u32 op = cft_map (opcode);
+#if COUNT_INSTRS == 2
+	if (table68k[op].handler != -1)
+		op = table68k[op].handler;
+	instrcount[op]++;
+	if (last_counted != 0xffffffff)
+		count_pair ((last_counted << 16) | op, 1);
+	last_counted = (table68k[op].cflow & (fl_end_block | fl_trap)) ? 0xffffffff : op;
+#else
+	instrcount[op]++;
+#endif
+}
+#endif
+
 void REGPARAM2 op_illg_1 (uae_u32 opcode) REGPARAM;
 
 void REGPARAM2 op_illg_1 (uae_u32 opcode)
@@ -202,33 +293,16 @@ void REGPARAM2 op_illg_1 (uae_u32 opcode)
 	op_illg (cft_map (opcode));
 }
 
-static void build_cpufunctbl (void)
+static void build_functbl (cpuop_func **functbl, struct cputbl *tbl, unsigned int cpu_level)
 {
 	int i;
 	unsigned long opcode;
-	unsigned int cpu_level = 0;		// 68000 (default)
-	if (CPUType == 4)
-		cpu_level = 4;		// 68040 with FPU
-	else {
-		if (FPUType)
-			cpu_level = 3;	// 68020 with FPU
-		else if (CPUType >= 2)
-			cpu_level = 2;	// 68020
-		else if (CPUType == 1)
-			cpu_level = 1;
-	}
-	struct cputbl *tbl = (
-				cpu_level == 4 ? op_smalltbl_0_ff
-				: cpu_level == 3 ? op_smalltbl_1_ff
-				: cpu_level == 2 ? op_smalltbl_2_ff
-				: cpu_level == 1 ? op_smalltbl_3_ff
-				: op_smalltbl_4_ff);
 
 	for (opcode = 0; opcode < 65536; opcode++)
-		cpufunctbl[cft_map (opcode)] = op_illg_1;
+		functbl[cft_map (opcode)] = op_illg_1;
 	for (i = 0; tbl[i].handler != NULL; i++) {
 		if (! tbl[i].specific)
-			cpufunctbl[cft_map (tbl[i].opcode)] = tbl[i].handler;
+			functbl[cft_map (tbl[i].opcode)] = tbl[i].handler;
 	}
 	for (opcode = 0; opcode < 65536; opcode++) {
 		cpuop_func *f;
@@ -237,18 +311,64 @@ static void build_cpufunctbl (void)
 			continue;
 
 		if (table68k[opcode].handler != -1) {
-			f = cpufunctbl[cft_map (table68k[opcode].handler)];
+			f = functbl[cft_map (table68k[opcode].handler)];
 			if (f == op_illg_1)
 				abort();
-			cpufunctbl[cft_map (opcode)] = f;
+			functbl[cft_map (opcode)] = f;
 		}
 	}
 	for (i = 0; tbl[i].handler != NULL; i++) {
 		if (tbl[i].specific)
-			cpufunctbl[cft_map (tbl[i].opcode)] = tbl[i].handler;
+			functbl[cft_map (tbl[i].opcode)] = tbl[i].handler;
 	}
 }
 
+static void build_cpufunctbl (void)
+{
+	unsigned int cpu_level = 0;		// 68000 (default)
+	if (CPUType == 4)
+		cpu_level = 4;		// 68040 with FPU
+	else {
+		if (FPUType)
+			cpu_level = 3;	// 68020 with FPU
+		else if (CPUType >= 2)
+			cpu_level = 2;	// 68020
+		else if (CPUType == 1)
+			cpu_level = 1;
+	}
+	struct cputbl *tbl = (
+				cpu_level == 4 ? op_smalltbl_0_ff
+				: cpu_level == 3 ? op_smalltbl_1_ff
+				: cpu_level == 2 ? op_smalltbl_2_ff
+				: cpu_level == 1 ? op_smalltbl_3_ff
+				: op_smalltbl_4_ff);
+	build_functbl(cpufunctbl, tbl, cpu_level);
+
+	struct cpufusedtbl *fusedtbl = (
+				cpu_level == 4 ? op_fusedtbl_0_ff
+				: cpu_level == 3 ? op_fusedtbl_1_ff
+				: cpu_level == 2 ? op_fusedtbl_2_ff
+				: cpu_level == 1 ? op_fusedtbl_3_ff
+				: op_fusedtbl_4_ff);
+	memset(fused_pairs, 0, sizeof(fused_pairs));
+	for (int i = 0; fusedtbl[i].handler != NULL; i++) {
+		uae_u32 pair = (fusedtbl[i].first << 16) | fusedtbl[i].second;
+		uae_u32 h = fused_pair_hash(pair);
+		while (fused_pairs[h].handler)
+			h = (h + 1) & (FUSED_PAIRS_SIZE - 1);
+		fused_pairs[h].pair = pair;
+		fused_pairs[h].handler = fusedtbl[i].handler;
+	}
+
+	struct cputbl *nftbl = (
+				cpu_level == 4 ? op_smalltbl_0_nf
+				: cpu_level == 3 ? op_smalltbl_1_nf
+				: cpu_level == 2 ? op_smalltbl_2_nf
+				: cpu_level == 1 ? op_smalltbl_3_nf
+				: op_smalltbl_4_nf);
+	build_functbl(cpufunctbl_nf, nftbl, cpu_level);
+}
+
 void init_m68k (void)
 {
 	int i;
@@ -267,13 +387,20 @@ void init_m68k (void)
 		FILE *f = fopen (icountfilename (), "r");
 		memset (instrcount, 0, sizeof instrcount);
 		if (f) {
-			uae_u32 opcode, count, total;
+			unsigned long opcode, count, total;
 			char name[20];
 			write_log ("Reading instruction count file...\n");
 			fscanf (f, "Total: %lu\n", &total);
 			while (fscanf (f, "%lx: %lu %s\n", &opcode, &count, name) == 3) {
 				instrcount[opcode] = count;
 			}
+#if COUNT_INSTRS == 2
+			unsigned long second;
+			if (fscanf (f, "Pairs: %lu\n", &total) == 1) {
+				while (fscanf (f, "%lx %lx: %lu\n", &opcode, &second, &count) == 3)
+					count_pair ((opcode << 16) | second, count);
+			}
+#endif
 			fclose(f);
 		}
 	}
@@ -282,8 +409,9 @@ void init_m68k (void)
 	do_merges ();
 
 	build_cpufunctbl ();
+	use_predecode = PrefsFindBool("predecode");
 
-#if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
+#if SPCFLAGS_USE_LOCK
 	spcflags_lock = B2_create_mutex();
 #endif
 	fpu_init(CPUType == 4);
@@ -291,8 +419,11 @@ void init_m68k (void)
 
 void exit_m68k (void)
 {
+	dump_counts ();
 	fpu_exit ();
-#if defined(ENABLE_EXCLUSIVE_SPCFLAGS) && !defined(HAVE_HARDWARE_LOCKS)
+	free(predecode_cache);
+	predecode_cache = NULL;
+#if SPCFLAGS_USE_LOCK
 	B2_delete_mutex(spcflags_lock);
 #endif
 }
@@ -864,6 +995,9 @@ int m68k_move2c (int regno, uae_u32 *regp)
 			else {
 				set_cache_state(cacr&0x8000);
 			}
+#else
+			if (CPUType < 4 && (*regp & 0x08))
+				flush_icache(1);
 #endif
 			break;
 		case 3: tc = *regp & 0xc000; break;
@@ -1342,6 +1476,9 @@ int m68k_do_specialties (void)
 				regs.stopped = 0;
 				SPCFLAGS_CLEAR( SPCFLAG_STOP );
 			}
+		} else {
+			// Sleep until TriggerInterrupt() wakes us up
+			idle_wait();
 		}
 	}
 	if (SPCFLAGS_TEST( SPCFLAG_TRACE ))
@@ -1351,6 +1488,8 @@ int m68k_do_specialties (void)
 		SPCFLAGS_CLEAR( SPCFLAG_DOINT );
 		int intr = intlev ();
 		if (intr != -1 && intr > regs.intmask) {
+			if (idle_detect_interrupt(m68k_getpc()))
+				SPCFLAGS_SET( SPCFLAG_IDLE );
 			Interrupt (intr);
 			regs.stopped = 0;
 		}
@@ -1359,6 +1498,8 @@ int m68k_do_specialties (void)
 		SPCFLAGS_CLEAR( SPCFLAG_INT );
 		SPCFLAGS_SET( SPCFLAG_DOINT );
 	}
+	if (SPCFLAGS_TEST( SPCFLAG_IDLE ) && !idle_detect_check(m68k_getpc()))
+		SPCFLAGS_CLEAR( SPCFLAG_IDLE );
 	if (SPCFLAGS_TEST( SPCFLAG_BRK )) {
 		SPCFLAGS_CLEAR( SPCFLAG_BRK );
 		return 1;
@@ -1366,15 +1507,20 @@ int m68k_do_specialties (void)
 	return 0;
 }
 
-void m68k_do_execute (void)
+template <bool count_ticks>
+static void m68k_do_execute_1 (void)
 {
 	for (;;) {
 		uae_u32 opcode = GET_OPCODE;
 #if FLIGHT_RECORDER
 		m68k_record_step(m68k_getpc());
+#endif
+#if COUNT_INSTRS
+		count_instr(opcode);
 #endif
 		(*cpufunctbl[opcode])(opcode);
-		cpu_check_ticks();
+		if (count_ticks)
+			cpu_check_ticks();
 		if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN)) {
 			if (m68k_do_specialties())
 				return;
@@ -1382,6 +1528,235 @@ void m68k_do_execute (void)
 	}
 }
 
+void m68k_do_execute (void)
+{
+#ifdef USE_CPU_EMUL_TICKS
+	if (cpu_count_ticks)
+		m68k_do_execute_1<true>();
+	else
+#endif
+		m68k_do_execute_1<false>();
+}
+
+/*
+ * Predecoding interpreter: the instructions run from a given address are
+ * kept together with their handlers in a small cache, so that running them
+ * again neither fetches the opcode nor goes through cpufunctbl[]. A block
+ * follows the flow through branches, calls and returns as it was recorded;
+ * the replay stops where an instruction goes somewhere else than the next
+ * entry. The handlers still read their extension words. Like the JIT
+ * translation cache, the cache relies on flush_icache() being called when
+ * code is modified; that only bumps a generation number, so that the
+ * blocks recorded before it are not used again.
+ *
+ * A flag liveness pass over each recorded block selects the no-flags
+ * handlers for instructions whose flags are all set again before being
+ * read. Pairs of instructions that gencpu made a fused handler for are
+ * run through it, as a single entry.
+ */
+
+const int PREDECODE_BLOCKS = 1024;	// Number of cache entries, a power of 2
+const int PREDECODE_MAXLEN = 32;	// Maximum number of instructions in a block
+
+struct predecoded_insn {
+	uae_u8 *pc_p;
+	cpuop_func *handler;
+	uae_u32 opcode;
+	bool fused;			// Handler also runs the instruction following
+};
+
+struct predecoded_block {
+	uae_u8 *pc_p;
+	uae_u32 gen;		// Value of predecode_gen when recorded
+	int len;
+	predecoded_insn insn[PREDECODE_MAXLEN];
+};
+
+static uae_u32 predecode_gen = 1;	// Blocks with another generation are stale
+
+static inline predecoded_block *predecode_lookup(uae_u8 *pc_p)
+{
+	return &predecode_cache[((uintptr)pc_p >> 1) & (PREDECODE_BLOCKS - 1)];
+}
+
+static void predecode_select_nf(predecoded_block *b)
+{
+	// Nothing is known about what comes after the block
+	int live = 0x1f;
+	for (int n = b->len - 1; n >= 0; n--) {
+		predecoded_insn *i = &b->insn[n];
+		struct instr *insn = &table68k[cft_map(i->opcode)];
+		int set = insn->flagdead < 0 ? 0 : insn->flagdead;
+		int use = insn->flaglive;
+		// The flags may be read wherever a branch goes when not replayed
+		if (insn->cflow & fl_end_block)
+			live = 0x1f;
+		// Exceptions save the SR, consider their flags read
+		if (use < 0 || insn->mnemo == i_ILLG || (insn->cflow & fl_trap))
+			use = 0x1f;
+		// Without optimized flags, CAS and CAS2 lose the Z flag they test
+		if (set != 0 && (set & live) == 0 && insn->mnemo != i_CAS && insn->mnemo != i_CAS2)
+			i->handler = cpufunctbl_nf[i->opcode];
+		live = (live & ~set) | use;
+	}
+}
+
+static inline uae_u32 predecode_family(uae_u32 opcode)
+{
+	uae_u32 op = cft_map(opcode);
+	return table68k[op].handler != -1 ? table68k[op].handler : op;
+}
+
+// Replace pairs with a fused handler by a single entry, compacting the block
+static void predecode_fuse(predecoded_block *b)
+{
+	int len = 0;
+	for (int n = 0; n < b->len; n++) {
+		predecoded_insn *i = &b->insn[n];
+		b->insn[len] = *i;
+		if (n + 1 < b->len) {
+			uae_u32 pair = (predecode_family(i[0].opcode) << 16) | predecode_family(i[1].opcode);
+			for (uae_u32 h = fused_pair_hash(pair); fused_pairs[h].handler; h = (h + 1) & (FUSED_PAIRS_SIZE - 1)) {
+				if (fused_pairs[h].pair == pair) {
+					b->insn[len].handler = fused_pairs[h].handler;
+					b->insn[len].fused = true;
+					n++;
+					break;
+				}
+			}
+		}
+		len++;
+	}
+	b->len = len;
+}
+
+static void predecode_store(predecoded_block *b, predecoded_block *rec)
+{
+	predecode_select_nf(rec);
+	predecode_fuse(rec);
+	b->pc_p = rec->pc_p;
+	b->gen = rec->gen;
+	b->len = rec->len;
+	memcpy(b->insn, rec->insn, rec->len * sizeof(predecoded_insn));
+}
+
+// The entries after an instruction that flushes the cache would be stale.
+// EMUL_OPs and traps end blocks as well, plain branches don't
+static inline bool predecode_ends_block(uae_u32 opcode)
+{
+	struct instr *insn = &table68k[cft_map(opcode)];
+	switch (insn->mnemo) {
+	case i_CINVL: case i_CINVP: case i_CINVA:
+	case i_CPUSHL: case i_CPUSHP: case i_CPUSHA:
+	case i_MOVE2C:
+		return true;
+	case i_Bcc: case i_BSR: case i_DBcc: case i_FBcc: case i_FDBcc:
+	case i_JMP: case i_JSR: case i_RTS: case i_RTD: case i_RTR:
+		return false;
+	default:
+		return (insn->cflow & fl_end_block) != 0;
+	}
+}
+
+void predecode_flush (int)
+{
+	// Blocks from 2^32 flushes ago would match again after a wrap
+	if (++predecode_gen == 0) {
+		if (predecode_cache)
+			memset(predecode_cache, 0, PREDECODE_BLOCKS * sizeof(predecoded_block));
+		predecode_gen = 1;
+	}
+}
+
+/* Run a block while recording it into B, return true to leave the
+   emulation loop. This is done aside since EMUL_OPs, which end blocks,
+   may call back into m68k_execute() and use the cache in the meantime */
+template <bool count_ticks>
+static bool predecode_record (predecoded_block *b)
+{
+	predecoded_block rec;
+	rec.pc_p = regs.pc_p;
+	rec.gen = predecode_gen;	// Not stored if code is flushed meanwhile
+	rec.len = 0;
+	bool special = false;
+	while (rec.len < PREDECODE_MAXLEN) {
+		uae_u32 opcode = GET_OPCODE;
+		predecoded_insn *i = &rec.insn[rec.len++];
+		i->pc_p = regs.pc_p;
+		i->handler = cpufunctbl[opcode];
+		i->opcode = opcode;
+		i->fused = false;
+#if FLIGHT_RECORDER
+		m68k_record_step(m68k_getpc());
+#endif
+		(*i->handler)(opcode);
+		if (count_ticks)
+			cpu_check_ticks();
+		if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN)) {
+			special = true;
+			break;
+		}
+		// A loop back to the start is chained without a lookup
+		if (predecode_ends_block(opcode) || regs.pc_p == rec.pc_p)
+			break;
+	}
+	if (rec.gen == predecode_gen)
+		predecode_store(b, &rec);
+	return special && m68k_do_specialties();
+}
+
+template <bool count_ticks>
+static void m68k_do_execute_predecoded_1 (void)
+{
+	for (;;) {
+		predecoded_block *b = predecode_lookup(regs.pc_p);
+		if (b->pc_p != regs.pc_p || b->gen != predecode_gen) {
+			if (predecode_record<count_ticks>(b))
+				return;
+			continue;
+		}
+		do {
+			predecoded_insn *i = b->insn, *end = b->insn + b->len;
+			do {
+#if FLIGHT_RECORDER
+				m68k_record_step(m68k_getpc());
+#endif
+				(*i->handler)(i->opcode);
+				if (count_ticks) {
+					cpu_check_ticks();
+					if (i->fused)
+						cpu_check_ticks();
+				}
+				if (SPCFLAGS_TEST(SPCFLAG_ALL_BUT_EXEC_RETURN)) {
+					if (m68k_do_specialties())
+						return;
+					break;
+				}
+				// Stop where a branch or an exception left the recorded path
+			} while (++i < end && i->pc_p == regs.pc_p);
+			// A loop back to the start of the block needs no lookup
+		} while (b->pc_p == regs.pc_p && b->gen == predecode_gen);
+	}
+}
+
+void m68k_do_execute_predecoded (void)
+{
+	if (predecode_cache == NULL) {
+		predecode_cache = (predecoded_block *)calloc(PREDECODE_BLOCKS, sizeof(predecoded_block));
+		if (predecode_cache == NULL) {
+			use_predecode = false;
+			return;
+		}
+	}
+
+#ifdef USE_CPU_EMUL_TICKS
+	if (cpu_count_ticks)
+		m68k_do_execute_predecoded_1<true>();
+	else
+#endif
+		m68k_do_execute_predecoded_1<false>();
+}
+
 void m68k_execute (void)
 {
 #if USE_JIT
@@ -1390,7 +1765,10 @@ void m68k_execute (void)
 	for (;;) {
 		if (quit_program)
 			break;
-		m68k_do_execute();
+		if (use_predecode)
+			m68k_do_execute_predecoded();
+		else
+			m68k_do_execute();
 	}
 #if USE_JIT
 	--m68k_execute_depth;
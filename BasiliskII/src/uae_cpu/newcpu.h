@@ -67,6 +67,14 @@ struct cputbl {
     uae_u16 opcode;
 };
 
+/* Handlers for pairs of instructions, generated by gencpu from the
+   frequent.68k profile */
+struct cpufusedtbl {
+    cpuop_func *handler;
+    uae_u16 first;
+    uae_u16 second;
+};
+
 extern cpuop_func *cpufunctbl[65536] ASM_SYM("cpufunctbl");
 
 #if USE_JIT
@@ -330,15 +338,31 @@ extern struct cputbl op_smalltbl_3_ff[];
 /* 68000 slow but compatible.  */
 extern struct cputbl op_smalltbl_4_ff[];
 
+extern struct cpufusedtbl op_fusedtbl_0_ff[];
+extern struct cpufusedtbl op_fusedtbl_1_ff[];
+extern struct cpufusedtbl op_fusedtbl_2_ff[];
+extern struct cpufusedtbl op_fusedtbl_3_ff[];
+extern struct cpufusedtbl op_fusedtbl_4_ff[];
+
+/* Same as above, without flags computation */
+extern struct cputbl op_smalltbl_0_nf[];
+extern struct cputbl op_smalltbl_1_nf[];
+extern struct cputbl op_smalltbl_2_nf[];
+extern struct cputbl op_smalltbl_3_nf[];
+extern struct cputbl op_smalltbl_4_nf[];
+
 #if FLIGHT_RECORDER
 extern void m68k_record_step(uaecptr) REGPARAM;
 #endif
 extern void m68k_do_execute(void);
+extern void m68k_do_execute_predecoded(void);
 extern void m68k_execute(void);
+extern void predecode_flush(int);
 #if USE_JIT
 extern void m68k_compile_execute(void);
 #endif
-#ifdef USE_CPU_EMUL_SERVICES
+#ifdef USE_CPU_EMUL_TICKS
+extern bool cpu_count_ticks;
 extern int32 emulated_ticks;
 extern void cpu_do_check_ticks(void);
 
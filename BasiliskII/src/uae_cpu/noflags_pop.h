@@ -0,0 +1,20 @@
+/* Restores the flag setting macros saved by noflags_push.h */
+
+#pragma pop_macro("SET_ZFLG")
+#pragma pop_macro("SET_CFLG")
+#pragma pop_macro("SET_VFLG")
+#pragma pop_macro("SET_NFLG")
+#pragma pop_macro("SET_XFLG")
+#pragma pop_macro("CLEAR_CZNV")
+#pragma pop_macro("IOR_CZNV")
+#pragma pop_macro("SET_CZNV")
+#pragma pop_macro("COPY_CARRY")
+#pragma pop_macro("optflag_testl")
+#pragma pop_macro("optflag_testw")
+#pragma pop_macro("optflag_testb")
+#pragma pop_macro("optflag_addl")
+#pragma pop_macro("optflag_addw")
+#pragma pop_macro("optflag_addb")
+#pragma pop_macro("optflag_subl")
+#pragma pop_macro("optflag_subw")
+#pragma pop_macro("optflag_subb")
@@ -0,0 +1,73 @@
+/* Included by the fused handlers that gencpu generates, around the code of
+   an instruction whose flags are all set again by the next one. Same idea
+   as noflags.h, but for part of a function only: the flag setting macros
+   are saved here, made no-ops, and restored by noflags_pop.h. No include
+   guard, this is included once per fused handler.
+
+   The instructions that read back the flags they set (CAS, CHK2 and the
+   bitfield ones) are never compiled this way, so there's no need for the
+   SET_?FLG_ALWAYS trickery of noflags.h. */
+
+#pragma push_macro("SET_ZFLG")
+#pragma push_macro("SET_CFLG")
+#pragma push_macro("SET_VFLG")
+#pragma push_macro("SET_NFLG")
+#pragma push_macro("SET_XFLG")
+#pragma push_macro("CLEAR_CZNV")
+#pragma push_macro("IOR_CZNV")
+#pragma push_macro("SET_CZNV")
+#pragma push_macro("COPY_CARRY")
+#pragma push_macro("optflag_testl")
+#pragma push_macro("optflag_testw")
+#pragma push_macro("optflag_testb")
+#pragma push_macro("optflag_addl")
+#pragma push_macro("optflag_addw")
+#pragma push_macro("optflag_addb")
+#pragma push_macro("optflag_subl")
+#pragma push_macro("optflag_subw")
+#pragma push_macro("optflag_subb")
+
+#ifndef OPTIMIZED_FLAGS
+#undef SET_ZFLG
+#define SET_ZFLG(y) do {uae_u32 dummy=(y); } while (0)
+#endif
+
+#undef SET_CFLG
+#define SET_CFLG(y) do {uae_u32 dummy=(y); } while (0)
+#undef SET_VFLG
+#define SET_VFLG(y) do {uae_u32 dummy=(y); } while (0)
+#undef SET_NFLG
+#define SET_NFLG(y) do {uae_u32 dummy=(y); } while (0)
+#undef SET_XFLG
+#define SET_XFLG(y) do {uae_u32 dummy=(y); } while (0)
+
+#undef CLEAR_CZNV
+#define CLEAR_CZNV
+#undef IOR_CZNV
+#define IOR_CZNV(y) do {uae_u32 dummy=(y); } while (0)
+#undef SET_CZNV
+#define SET_CZNV(y) do {uae_u32 dummy=(y); } while (0)
+#undef COPY_CARRY
+#define COPY_CARRY
+
+#undef optflag_testl
+#undef optflag_testw
+#undef optflag_testb
+#undef optflag_addl
+#undef optflag_addw
+#undef optflag_addb
+#undef optflag_subl
+#undef optflag_subw
+#undef optflag_subb
+
+#define optflag_testl(v) do { } while (0)
+#define optflag_testw(v) do { } while (0)
+#define optflag_testb(v) do { } while (0)
+
+#define optflag_addl(v, s, d) (v = (uae_s32)(d) + (uae_s32)(s))
+#define optflag_addw(v, s, d) (v = (uae_s16)(d) + (uae_s16)(s))
+#define optflag_addb(v, s, d) (v = (uae_s8)(d) + (uae_s8)(s))
+
+#define optflag_subl(v, s, d) (v = (uae_s32)(d) - (uae_s32)(s))
+#define optflag_subw(v, s, d) (v = (uae_s16)(d) - (uae_s16)(s))
+#define optflag_subb(v, s, d) (v = (uae_s8)(d) - (uae_s8)(s))
@@ -39,6 +39,7 @@ enum {
 	SPCFLAG_JIT_END_COMPILE		= 0,
 	SPCFLAG_JIT_EXEC_RETURN		= 0,
 #endif
+	SPCFLAG_IDLE				= 0x100,
 	
 	SPCFLAG_ALL					= SPCFLAG_STOP
 								| SPCFLAG_INT
@@ -46,6 +47,7 @@ enum {
 								| SPCFLAG_TRACE
 								| SPCFLAG_DOTRACE
 								| SPCFLAG_DOINT
+								| SPCFLAG_IDLE
 								| SPCFLAG_JIT_END_COMPILE
 								| SPCFLAG_JIT_EXEC_RETURN
 								,
@@ -53,43 +55,59 @@ enum {
 	SPCFLAG_ALL_BUT_EXEC_RETURN	= SPCFLAG_ALL & ~SPCFLAG_JIT_EXEC_RETURN
 };
 
-#define SPCFLAGS_TEST(m) \
-	((regs.spcflags & (m)) != 0)
+/*
+ *  Flags are set from other threads (TriggerInterrupt() etc.) while the
+ *  CPU thread clears them, so updates are atomic read-modify-write
+ *  operations. Setting a flag releases the writes made before it, like
+ *  InterruptFlags, to the CPU thread that tests it with acquire semantics.
+ *  Clearing a flag acquires them as well, so that InterruptFlags read
+ *  after clearing SPCFLAG_INT holds whatever came with a concurrent set.
+ */
 
 /* Macro only used in m68k_reset() */
 #define SPCFLAGS_INIT(m) do { \
 	regs.spcflags = (m); \
 } while (0)
 
-#if !(ENABLE_EXCLUSIVE_SPCFLAGS)
+#if defined(__GNUC__)
+
+#define SPCFLAGS_TEST(m) \
+	((__atomic_load_n(&regs.spcflags, __ATOMIC_ACQUIRE) & (m)) != 0)
 
 #define SPCFLAGS_SET(m) do { \
-	regs.spcflags |= (m); \
+	__atomic_fetch_or(&regs.spcflags, (m), __ATOMIC_RELEASE); \
 } while (0)
 
 #define SPCFLAGS_CLEAR(m) do { \
-	regs.spcflags &= ~(m); \
+	__atomic_fetch_and(&regs.spcflags, ~(m), __ATOMIC_ACQ_REL); \
 } while (0)
 
-#elif defined(X86_ASSEMBLY)
+#elif defined(_MSC_VER)
 
-#define HAVE_HARDWARE_LOCKS
+#include <intrin.h>
+
+/* Interlocked operations are full barriers, volatile reads acquire */
+#define SPCFLAGS_TEST(m) \
+	((*(volatile spcflags_t *)&regs.spcflags & (m)) != 0)
 
 #define SPCFLAGS_SET(m) do { \
-	__asm__ __volatile__("lock\n\torl %1,%0" : "=m" (regs.spcflags) : "i" ((m))); \
+	_InterlockedOr((volatile long *)&regs.spcflags, (m)); \
 } while (0)
 
 #define SPCFLAGS_CLEAR(m) do { \
-	__asm__ __volatile__("lock\n\tandl %1,%0" : "=m" (regs.spcflags) : "i" (~(m))); \
+	_InterlockedAnd((volatile long *)&regs.spcflags, ~(m)); \
 } while (0)
 
 #else
 
-#undef HAVE_HARDWARE_LOCKS
+#define SPCFLAGS_USE_LOCK 1
 
 #include "main.h"
 extern B2_mutex *spcflags_lock;
 
+#define SPCFLAGS_TEST(m) \
+	((*(volatile spcflags_t *)&regs.spcflags & (m)) != 0)
+
 #define SPCFLAGS_SET(m) do { 				\
 	B2_lock_mutex(spcflags_lock);			\
 	regs.spcflags |= (m);					\